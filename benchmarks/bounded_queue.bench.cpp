@@ -0,0 +1,172 @@
+/// Producer/consumer rate mismatch through queued Slots.
+/** A producer thread emits faster than the consumer loop can process, the
+ *  resident set size is sampled while it runs. The unbounded Event_queue grows
+ *  for the whole run, every Bounded_event_queue policy stays flat.
+ *
+ *  Usage: signals_light_bounded_queue_bench [seconds per run] */
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <signals_light/event_queue.hpp>
+#include <signals_light/signal.hpp>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+auto constexpr payload_size  = std::size_t{256};
+auto constexpr producer_rate = 200'000;  // Emissions per second.
+auto constexpr consumer_cost = std::chrono::microseconds{20};
+auto constexpr capacity      = std::size_t{1'024};
+auto constexpr key_count     = std::uint64_t{64};
+auto constexpr sample_period = std::chrono::milliseconds{100};
+
+/// Return the resident set size of this process in KiB.
+auto rss_kib() -> long
+{
+    auto* const file = std::fopen("/proc/self/statm", "r");
+    if (file == nullptr)
+        return -1;
+    auto size     = 0L;
+    auto resident = 0L;
+    auto const n  = std::fscanf(file, "%ld %ld", &size, &resident);
+    std::fclose(file);
+    return n == 2 ? resident * (::sysconf(_SC_PAGESIZE) / 1024) : -1;
+}
+
+/// Spin for \p d, standing in for a slow Slot.
+void busy_wait(Clock::duration d)
+{
+    auto const end = Clock::now() + d;
+    while (Clock::now() < end) {}
+}
+
+struct Result {
+    long rss_start;
+    long rss_peak;
+    long rss_end;
+    std::uint64_t emitted;
+    std::uint64_t delivered;
+};
+
+/// Emit from a rate limited producer thread while \p process drains.
+template <typename Process>
+auto run(sl::Signal<void(int, std::string const&)>& sig,
+         Process process,
+         Clock::duration duration) -> Result
+{
+    auto result      = Result{rss_kib(), 0, 0, 0, 0};
+    auto done        = std::atomic<bool>{false};
+    auto finished    = std::atomic<bool>{false};
+    auto emitted     = std::atomic<std::uint64_t>{0};
+    auto const start = Clock::now();
+
+    auto producer = std::thread{[&] {
+        auto const payload = std::string(payload_size, 'x');
+        auto const period  = std::chrono::nanoseconds{1'000'000'000} /
+                            producer_rate;
+        auto next = Clock::now();
+        for (auto i = 0; !done.load(std::memory_order_relaxed); ++i) {
+            sig(i, payload);
+            emitted.fetch_add(1, std::memory_order_relaxed);
+            next += period;
+            if (i % 1'000 == 0)
+                std::this_thread::sleep_until(next);
+        }
+        finished = true;
+    }};
+
+    auto next_sample = start + sample_period;
+    while (Clock::now() - start < duration) {
+        result.delivered += process();
+        if (Clock::now() >= next_sample) {
+            result.rss_peak = std::max(result.rss_peak, rss_kib());
+            next_sample += sample_period;
+        }
+    }
+    // Keep draining, a Blocked producer needs room to notice it is done.
+    done = true;
+    while (!finished)
+        process();
+    producer.join();
+    result.rss_end  = rss_kib();
+    result.rss_peak = std::max(result.rss_peak, result.rss_end);
+    result.emitted  = emitted.load();
+    return result;
+}
+
+void print(char const* name,
+           Result const& r,
+           std::uint64_t dropped,
+           std::uint64_t coalesced)
+{
+    std::printf("%-14s %10ld %10ld %10ld %12llu %12llu %10llu %10llu\n", name,
+                r.rss_start, r.rss_peak, r.rss_end,
+                static_cast<unsigned long long>(r.emitted),
+                static_cast<unsigned long long>(r.delivered),
+                static_cast<unsigned long long>(dropped),
+                static_cast<unsigned long long>(coalesced));
+}
+
+auto slow_slot() -> sl::Slot<void(int, std::string const&)>
+{
+    return [](int, std::string const&) { busy_wait(consumer_cost); };
+}
+
+auto key_of(int i, std::string const&) -> std::uint64_t
+{
+    return static_cast<std::uint64_t>(i) % key_count;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    auto const seconds  = argc > 1 ? std::atof(argv[1]) : 2.0;
+    auto const duration = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>{seconds});
+
+    std::printf("%-14s %10s %10s %10s %12s %12s %10s %10s\n", "policy",
+                "rss0 KiB", "peak KiB", "end KiB", "emitted", "delivered",
+                "dropped", "coalesced");
+
+    struct Policy {
+        char const* name;
+        sl::Overflow overflow;
+    };
+    for (auto const& [name, overflow] :
+         {Policy{"block", sl::Overflow::Block},
+          Policy{"drop_newest", sl::Overflow::Drop_newest},
+          Policy{"drop_oldest", sl::Overflow::Drop_oldest},
+          Policy{"coalesce", sl::Overflow::Coalesce}}) {
+        auto queue = sl::Bounded_event_queue{capacity, overflow};
+        auto sig   = sl::Signal<void(int, std::string const&)>{};
+        if (overflow == sl::Overflow::Coalesce)
+            sig.connect(sl::queued(queue, slow_slot(), key_of));
+        else
+            sig.connect(sl::queued(queue, slow_slot()));
+        auto const r =
+            run(sig, [&queue] { return queue.process_events(); }, duration);
+        print(name, r, queue.dropped(), queue.coalesced());
+    }
+
+    // Last, the heap does not shrink back after this run.
+    {
+        auto queue = sl::Event_queue{};
+        auto sig   = sl::Signal<void(int, std::string const&)>{};
+        sig.connect(sl::queued(queue, slow_slot()));
+        auto const r =
+            run(sig, [&queue] { return queue.process_events(); }, duration);
+        print("unbounded", r, 0, 0);
+    }
+}
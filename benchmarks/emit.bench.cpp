@@ -0,0 +1,243 @@
+/// Emit cost of sl::Signal against alternative observer designs.
+/** Every implementation runs the same workload: N observers, each adding the
+ *  emitted int to a sink. Reported in nanoseconds per emit, for several slot
+ *  counts and for the fraction of observers tracking a lifetime. Designs
+ *  without lifetime tracking only run untracked. The Point row emits a small
+ *  struct by const reference instead, opted in to sl::is_passed_by_value so
+ *  it is passed as a copy.
+ *  Boost.Signals2 is included when built with SIGNALS_LIGHT_HAVE_BOOST.
+ *
+ *  Usage: signals_light_emit_bench [slot invocations per measurement] */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef SIGNALS_LIGHT_HAVE_BOOST
+#include <boost/signals2.hpp>
+#endif
+
+#include <signals_light/signal.hpp>
+#include <signals_light/variant_slots.hpp>
+
+namespace {
+
+std::uint64_t sink = 0;
+
+/// Keep the compiler from discarding the work done on \p x.
+template <typename T>
+void do_not_optimize(T const& x)
+{
+    asm volatile("" : : "r,m"(x) : "memory");
+}
+
+/// The work done by every observer, never inlined so no design can fold it.
+[[gnu::noinline]] void add(int x) { sink += static_cast<std::uint64_t>(x); }
+
+/// Return true if observer \p i of \p n is tracked at \p ratio.
+auto is_tracked(std::size_t i, std::size_t n, double ratio) -> bool
+{
+    return static_cast<double>(i) < ratio * static_cast<double>(n);
+}
+
+/// Return nanoseconds per call of \p emit, run \p iterations times.
+template <typename F>
+auto measure(F&& emit, long iterations) -> double
+{
+    for (auto i = 0L; i < iterations / 10 + 1; ++i)
+        emit(static_cast<int>(i));
+    auto const start = std::chrono::steady_clock::now();
+    for (auto i = 0L; i < iterations; ++i)
+        emit(static_cast<int>(i));
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+    do_not_optimize(sink);
+    return std::chrono::duration<double, std::nano>(elapsed).count() /
+           static_cast<double>(iterations);
+}
+
+auto bench_sl(std::size_t n, double ratio, long iterations) -> double
+{
+    auto const life = sl::Lifetime{};
+    auto sig        = sl::Signal<void(int)>{};
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        auto slot = sl::Slot<void(int)>{[](int x) { add(x); }};
+        if (is_tracked(i, n, ratio))
+            slot.track(life);
+        sig.connect(std::move(slot));
+    }
+    return measure([&](int x) { sig(x); }, iterations);
+}
+
+struct Point {
+    int x;
+    int y;
+};
+
+}  // namespace
+
+template <>
+struct sl::is_passed_by_value<Point> : std::true_type {};
+
+namespace {
+
+auto bench_sl_point(std::size_t n, double ratio, long iterations) -> double
+{
+    auto const life = sl::Lifetime{};
+    auto sig        = sl::Signal<void(Point const&)>{};
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        auto slot = sl::Slot<void(Point const&)>{
+            [](Point const& p) { add(p.x + p.y); }};
+        if (is_tracked(i, n, ratio))
+            slot.track(life);
+        sig.connect(std::move(slot));
+    }
+    return measure([&](int x) { sig(Point{x, 1}); }, iterations);
+}
+
+struct Add_slot {
+    void operator()(int x) const { add(x); }
+};
+
+auto bench_variant(std::size_t n, double ratio, long iterations) -> double
+{
+    auto const life = sl::Lifetime{};
+    auto sig = sl::Variant_slots_signal<void(int), Add_slot, void (*)(int)>{};
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        if (is_tracked(i, n, ratio))
+            sig.connect(Add_slot{}, life);
+        else
+            sig.connect(Add_slot{});
+    }
+    return measure([&](int x) { sig(x); }, iterations);
+}
+
+/// std::function observers, tracked ones hold a std::weak_ptr to check.
+auto bench_function_vector(std::size_t n, double ratio, long iterations)
+    -> double
+{
+    struct Observer {
+        std::function<void(int)> f;
+        std::weak_ptr<void> life;
+        bool tracked;
+    };
+    auto const life = std::make_shared<bool>(true);
+    auto observers  = std::vector<Observer>{};
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        auto const tracked = is_tracked(i, n, ratio);
+        observers.push_back({[](int x) { add(x); },
+                             tracked ? life : std::weak_ptr<void>{}, tracked});
+    }
+    return measure(
+        [&](int x) {
+            for (auto const& o : observers) {
+                if (o.tracked && o.life.expired())
+                    continue;
+                o.f(x);
+            }
+        },
+        iterations);
+}
+
+struct Listener {
+    virtual ~Listener()         = default;
+    virtual void notify(int x) = 0;
+};
+
+struct Adder : Listener {
+    void notify(int x) override { add(x); }
+};
+
+auto bench_virtual(std::size_t n, long iterations) -> double
+{
+    auto listeners = std::vector<std::unique_ptr<Listener>>{};
+    for (auto i = std::size_t{0}; i < n; ++i)
+        listeners.push_back(std::make_unique<Adder>());
+    return measure(
+        [&](int x) {
+            for (auto const& l : listeners)
+                l->notify(x);
+        },
+        iterations);
+}
+
+auto bench_function_pointer(std::size_t n, long iterations) -> double
+{
+    auto pointers = std::vector<void (*)(int)>(n, &add);
+    do_not_optimize(pointers.data());
+    return measure(
+        [&](int x) {
+            for (auto p : pointers)
+                p(x);
+        },
+        iterations);
+}
+
+#ifdef SIGNALS_LIGHT_HAVE_BOOST
+auto bench_boost(std::size_t n, double ratio, long iterations) -> double
+{
+    using Boost_signal = boost::signals2::signal<void(int)>;
+    auto const life    = std::make_shared<bool>(true);
+    auto sig           = Boost_signal{};
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        auto slot = Boost_signal::slot_type{[](int x) { add(x); }};
+        if (is_tracked(i, n, ratio))
+            slot.track_foreign(life);
+        sig.connect(slot);
+    }
+    return measure([&](int x) { sig(x); }, iterations);
+}
+#endif
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    auto const calls       = argc > 1 ? std::atol(argv[1]) : 20'000'000L;
+    auto const slot_counts = std::vector<std::size_t>{1, 4, 16, 64, 256};
+    auto const ratios      = std::vector<double>{0., .5, 1.};
+
+    for (auto const ratio : ratios) {
+        std::printf("\nns per emit, %3.0f%% of slots tracked\n", ratio * 100.);
+        std::printf("%-26s", "slots");
+        for (auto const n : slot_counts)
+            std::printf(" %10zu", n);
+        std::printf("\n");
+
+        auto const row = [&](char const* name, auto&& bench) {
+            std::printf("%-26s", name);
+            for (auto const n : slot_counts) {
+                auto const iterations = calls / static_cast<long>(n);
+                std::printf(" %10.2f", bench(n, iterations));
+            }
+            std::printf("\n");
+        };
+        row("sl::Signal", [&](std::size_t n, long iterations) {
+            return bench_sl(n, ratio, iterations);
+        });
+        row("sl::Signal, Point const&", [&](std::size_t n, long iterations) {
+            return bench_sl_point(n, ratio, iterations);
+        });
+        row("sl::Variant_slots_signal", [&](std::size_t n, long iterations) {
+            return bench_variant(n, ratio, iterations);
+        });
+        row("vector<function>", [&](std::size_t n, long iterations) {
+            return bench_function_vector(n, ratio, iterations);
+        });
+        if (ratio == 0.) {
+            row("virtual interface", bench_virtual);
+            row("function pointers", bench_function_pointer);
+        }
+#ifdef SIGNALS_LIGHT_HAVE_BOOST
+        row("boost::signals2", [&](std::size_t n, long iterations) {
+            return bench_boost(n, ratio, iterations);
+        });
+#endif
+    }
+}
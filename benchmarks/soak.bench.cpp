@@ -0,0 +1,242 @@
+/// Long running connect/disconnect/track/destroy churn.
+/** A fixed set of Signals is churned at random: Slots of varying capture size
+ *  are connected, some tracking a Lifetime from a shared pool, random Slots
+ *  are disconnected, random Lifetimes are destroyed and replaced, and Signals
+ *  are emitted. The resident set size, the malloc heap and the live and
+ *  expired Slot counts are sampled periodically. At the end the growth rate of
+ *  each is estimated over the second half of the run, after warm up, so leaks
+ *  from expired Slots and fragmentation regressions show as a steady slope.
+ *
+ *  Usage: signals_light_soak_bench [seconds] [sample period ms] [seed] */
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <malloc.h>
+#include <unistd.h>
+
+#include <signals_light/signal.hpp>
+
+#if defined(__GLIBC__) && \
+    (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+#define SIGNALS_LIGHT_HAVE_MALLINFO2
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+auto constexpr signal_count   = std::size_t{256};
+auto constexpr lifetime_count = std::size_t{1'024};
+auto constexpr target_slots   = std::size_t{16};  // Average per Signal.
+auto constexpr ops_per_check  = 1'024;
+
+/// Return the resident set size of this process in KiB.
+auto rss_kib() -> long
+{
+    auto* const file = std::fopen("/proc/self/statm", "r");
+    if (file == nullptr)
+        return -1;
+    auto size     = 0L;
+    auto resident = 0L;
+    auto const n  = std::fscanf(file, "%ld %ld", &size, &resident);
+    std::fclose(file);
+    return n == 2 ? resident * (::sysconf(_SC_PAGESIZE) / 1024) : -1;
+}
+
+struct Sample {
+    double seconds;
+    long rss_kib;
+    long heap_kib;       // Bytes in use by malloc.
+    long heap_free_kib;  // Free bytes inside the malloc heap.
+    long slots;          // Connected, including expired.
+    long expired_lifetimes;
+    long signal_kib;  // Sum of Signal::memory_usage().
+};
+
+/// Churns the Signals, one operation per step().
+class Churn {
+   public:
+    explicit Churn(std::uint32_t seed) : rng_{seed}
+    {
+        for (auto& life : lifetimes_)
+            life = std::make_unique<sl::Lifetime>();
+    }
+
+    void step()
+    {
+        auto const op     = std::uniform_int_distribution<int>{0, 99}(rng_);
+        auto const signal = this->pick(signal_count);
+        if (op < 35)
+            this->connect(signal);
+        else if (op < 70)
+            this->disconnect(signal);
+        else if (op < 75)
+            lifetimes_[this->pick(lifetime_count)] =
+                std::make_unique<sl::Lifetime>();
+        else
+            signals_[signal](static_cast<int>(op));
+    }
+
+    auto sample(double seconds) const -> Sample
+    {
+        auto slots  = 0L;
+        auto memory = std::size_t{0};
+        for (auto const& s : signals_) {
+            slots += static_cast<long>(s.slot_count());
+            memory += s.memory_usage();
+        }
+        auto const lives = sl::Lifetime::global_stats();
+        auto heap        = -1L;
+        auto heap_free   = -1L;
+#ifdef SIGNALS_LIGHT_HAVE_MALLINFO2
+        auto const info = ::mallinfo2();
+        heap            = static_cast<long>(info.uordblks / 1024);
+        heap_free       = static_cast<long>(info.fordblks / 1024);
+#endif
+        return {seconds,
+                rss_kib(),
+                heap,
+                heap_free,
+                slots,
+                static_cast<long>(lives.control_blocks - lives.live),
+                static_cast<long>(memory / 1024)};
+    }
+
+   private:
+    std::mt19937 rng_;
+    std::vector<sl::Signal<void(int)>> signals_ =
+        std::vector<sl::Signal<void(int)>>(signal_count);
+    std::vector<std::vector<sl::Identifier>> ids_ =
+        std::vector<std::vector<sl::Identifier>>(signal_count);
+    std::vector<std::unique_ptr<sl::Lifetime>> lifetimes_ =
+        std::vector<std::unique_ptr<sl::Lifetime>>(lifetime_count);
+    std::uint64_t sink_ = 0;
+
+   private:
+    auto pick(std::size_t n) -> std::size_t
+    {
+        return std::uniform_int_distribution<std::size_t>{0, n - 1}(rng_);
+    }
+
+    /// Connect a Slot with a small, medium or large capture.
+    void connect(std::size_t signal)
+    {
+        auto& ids = ids_[signal];
+        if (ids.size() >= 4 * target_slots)
+            return;
+        auto slot = [&]() -> sl::Slot<void(int)> {
+            switch (this->pick(3)) {
+                case 0:
+                    return [this](int x) { sink_ += x; };
+                case 1: {
+                    auto capture = std::array<std::uint64_t, 8>{};
+                    return [this, capture](int x) { sink_ += capture[0] + x; };
+                }
+                default: {
+                    auto capture = std::vector<int>(this->pick(256) + 1);
+                    return [this, capture](int x) {
+                        sink_ += capture.size() + x;
+                    };
+                }
+            }
+        }();
+        if (this->pick(2) == 0)
+            slot.track(*lifetimes_[this->pick(lifetime_count)]);
+        ids.push_back(signals_[signal].connect(std::move(slot)));
+    }
+
+    void disconnect(std::size_t signal)
+    {
+        auto& ids = ids_[signal];
+        if (ids.empty())
+            return;
+        auto const index = this->pick(ids.size());
+        signals_[signal].disconnect(ids[index]);
+        ids[index] = ids.back();
+        ids.pop_back();
+    }
+};
+
+/// Least squares slope of \p value over the second half of \p samples.
+template <typename F>
+auto slope_per_minute(std::vector<Sample> const& samples, F value) -> double
+{
+    auto const begin = samples.size() / 2;
+    auto const n     = static_cast<double>(samples.size() - begin);
+    if (n < 2)
+        return 0.;
+    auto sx  = 0.;
+    auto sy  = 0.;
+    auto sxx = 0.;
+    auto sxy = 0.;
+    for (auto i = begin; i < samples.size(); ++i) {
+        auto const x = samples[i].seconds / 60.;
+        auto const y = static_cast<double>(value(samples[i]));
+        sx += x;
+        sy += y;
+        sxx += x * x;
+        sxy += x * y;
+    }
+    auto const d = n * sxx - sx * sx;
+    return d == 0. ? 0. : (n * sxy - sx * sy) / d;
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    auto const seconds = argc > 1 ? std::atof(argv[1]) : 60.;
+    auto const period =
+        std::chrono::milliseconds{argc > 2 ? std::atol(argv[2]) : 1'000L};
+    auto const seed =
+        static_cast<std::uint32_t>(argc > 3 ? std::atol(argv[3]) : 1L);
+
+    auto churn       = Churn{seed};
+    auto samples     = std::vector<Sample>{};
+    auto ops         = std::uint64_t{0};
+    auto const start = Clock::now();
+    auto next        = start;
+    std::printf("%8s %10s %10s %10s %8s %8s %10s\n", "seconds", "rss KiB",
+                "heap KiB", "free KiB", "slots", "expired", "signal KiB");
+    while (true) {
+        auto const now = Clock::now();
+        auto const elapsed =
+            std::chrono::duration<double>(now - start).count();
+        if (now >= next) {
+            auto const s = churn.sample(elapsed);
+            samples.push_back(s);
+            std::printf("%8.1f %10ld %10ld %10ld %8ld %8ld %10ld\n", s.seconds,
+                        s.rss_kib, s.heap_kib, s.heap_free_kib, s.slots,
+                        s.expired_lifetimes, s.signal_kib);
+            std::fflush(stdout);
+            next += period;
+        }
+        if (elapsed >= seconds)
+            break;
+        for (auto i = 0; i < ops_per_check; ++i)
+            churn.step();
+        ops += ops_per_check;
+    }
+
+    std::printf("\n%llu operations, growth per minute over the second half:\n",
+                static_cast<unsigned long long>(ops));
+    std::printf("  rss        %10.1f KiB\n",
+                slope_per_minute(samples, [](auto& s) { return s.rss_kib; }));
+    std::printf("  heap       %10.1f KiB\n",
+                slope_per_minute(samples, [](auto& s) { return s.heap_kib; }));
+    std::printf("  heap free  %10.1f KiB\n",
+                slope_per_minute(samples,
+                                 [](auto& s) { return s.heap_free_kib; }));
+    std::printf("  slots      %10.1f\n",
+                slope_per_minute(samples, [](auto& s) { return s.slots; }));
+    std::printf("  expired    %10.1f\n",
+                slope_per_minute(samples,
+                                 [](auto& s) { return s.expired_lifetimes; }));
+}
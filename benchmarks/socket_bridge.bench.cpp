@@ -0,0 +1,93 @@
+/// Throughput of a Socket_sender/Socket_receiver pair over a socketpair.
+/** Compares flushing every emission against batched flushes of increasing
+ *  size. The receiver runs on its own thread with blocking reads.
+ *
+ *  Usage: signals_light_socket_bridge_bench [emissions per run] */
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <signals_light/signal.hpp>
+#include <signals_light/socket_bridge.hpp>
+
+namespace {
+
+/// Encodes an int followed by the bytes of a string.
+struct Codec {
+    void encode(std::string& out, int i, std::string const& s)
+    {
+        out.append(reinterpret_cast<char const*>(&i), sizeof(i));
+        out.append(s);
+    }
+
+    auto decode(std::string_view frame) -> std::tuple<int, std::string>
+    {
+        auto i = 0;
+        std::memcpy(&i, frame.data(), sizeof(i));
+        return {i, std::string{frame.substr(sizeof(i))}};
+    }
+};
+
+using Signature = void(int, std::string const&);
+
+void run(char const* name, std::size_t threshold, long count)
+{
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, fds) != 0) {
+        std::perror("socketpair");
+        std::exit(1);
+    }
+
+    auto received = 0L;
+    auto reads    = 0L;
+    auto consumer = std::thread{[&] {
+        auto receiver = sl::Socket_receiver<Signature, Codec>{fds[1]};
+        receiver.connect([&received](int, std::string const&) { ++received; });
+        while (received < count && !receiver.is_closed()) {
+            receiver.receive();
+            ++reads;
+        }
+    }};
+
+    auto const start   = std::chrono::steady_clock::now();
+    auto const payload = std::string(32, 'x');
+    {
+        auto sender = sl::Socket_sender<Signature, Codec>{fds[0], Codec{},
+                                                          threshold};
+        auto sig    = sl::Signal<Signature>{};
+        sig.connect(sender.slot());
+        for (auto i = 0L; i < count; ++i)
+            sig(static_cast<int>(i), payload);
+        sender.flush();
+        consumer.join();
+        auto const seconds = std::chrono::duration<double>(
+                                 std::chrono::steady_clock::now() - start)
+                                 .count();
+        std::printf("%-16s %12.0f %14llu %12ld\n", name, count / seconds,
+                    static_cast<unsigned long long>(sender.syscall_count()),
+                    reads);
+    }
+    ::close(fds[0]);
+    ::close(fds[1]);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    auto const count = argc > 1 ? std::atol(argv[1]) : 1'000'000L;
+    std::printf("%-16s %12s %14s %12s\n", "flush", "emits/s", "sendmsg calls",
+                "read calls");
+    run("every emit", 0, count);
+    run("4 KiB batches", 4 * 1'024, count);
+    run("64 KiB batches", 64 * 1'024, count);
+}
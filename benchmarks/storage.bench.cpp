@@ -0,0 +1,98 @@
+/// Emit and connect/disconnect cost of each Signal Storage policy.
+/** For several slot counts, measures nanoseconds per emit, and per operation
+ *  of a churn that disconnects a random Slot and connects a new one, keeping
+ *  the slot count constant. Fixed_storage is sized to the largest count.
+ *
+ *  Usage: signals_light_storage_bench [operations per measurement] */
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <signals_light/signal.hpp>
+#include <signals_light/slot_storage.hpp>
+
+namespace {
+
+auto constexpr max_slots = std::size_t{1'024};
+
+std::uint64_t sink = 0;
+
+template <typename T>
+void do_not_optimize(T const& x)
+{
+    asm volatile("" : : "r,m"(x) : "memory");
+}
+
+[[gnu::noinline]] void add(int x) { sink += static_cast<std::uint64_t>(x); }
+
+using Clock = std::chrono::steady_clock;
+
+auto ns_per(Clock::duration elapsed, long operations) -> double
+{
+    return std::chrono::duration<double, std::nano>(elapsed).count() /
+           static_cast<double>(operations);
+}
+
+struct Result {
+    double emit_ns;
+    double churn_ns;
+};
+
+template <typename Storage>
+auto bench(std::size_t n, long operations) -> Result
+{
+    // Fixed_storage<max_slots> is too large for the stack.
+    auto const sig = std::make_unique<sl::Signal<void(int), Storage>>();
+    auto ids       = std::vector<sl::Identifier>{};
+    for (auto i = std::size_t{0}; i < n; ++i)
+        ids.push_back(sig->connect([](int x) { add(x); }));
+
+    auto const emits = operations / static_cast<long>(n) + 1;
+    auto start       = Clock::now();
+    for (auto i = 0L; i < emits; ++i)
+        (*sig)(static_cast<int>(i));
+    auto const emit_ns = ns_per(Clock::now() - start, emits);
+
+    auto rng  = std::mt19937{1};
+    auto pick = std::uniform_int_distribution<std::size_t>{0, n - 1};
+    start     = Clock::now();
+    for (auto i = 0L; i < operations; ++i) {
+        auto& id = ids[pick(rng)];
+        sig->disconnect(id);
+        id = sig->connect([](int x) { add(x); });
+    }
+    auto const churn_ns = ns_per(Clock::now() - start, operations);
+    do_not_optimize(sink);
+    return {emit_ns, churn_ns};
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    auto const operations  = argc > 1 ? std::atol(argv[1]) : 2'000'000L;
+    auto const slot_counts = std::vector<std::size_t>{4, 64, max_slots};
+
+    std::printf("%-26s", "ns per emit / churn op");
+    for (auto const n : slot_counts)
+        std::printf(" %10zu %10s", n, "");
+    std::printf("\n");
+
+    auto const row = [&](char const* name, auto bench_fn) {
+        std::printf("%-26s", name);
+        for (auto const n : slot_counts) {
+            auto const r = bench_fn(n, operations);
+            std::printf(" %10.2f %10.2f", r.emit_ns, r.churn_ns);
+        }
+        std::printf("\n");
+    };
+    row("Vector_storage", &bench<sl::Vector_storage>);
+    row("Small_storage<4>", &bench<sl::Small_storage<4>>);
+    row("Fixed_storage<1024>", &bench<sl::Fixed_storage<max_slots>>);
+    row("Slot_map_storage", &bench<sl::Slot_map_storage>);
+}
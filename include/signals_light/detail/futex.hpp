@@ -0,0 +1,52 @@
+#ifndef SIGNALS_LIGHT_DETAIL_FUTEX_HPP
+#define SIGNALS_LIGHT_DETAIL_FUTEX_HPP
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace sl::detail {
+
+static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t) &&
+                  std::atomic<std::uint32_t>::is_always_lock_free,
+              "futex words must be plain 32 bit integers.");
+
+/// Block while \p word holds \p expected, for at most \p timeout.
+/** \p shared must be true if \p word lives in memory shared between
+ *  processes. Returns false if the timeout elapsed, true on a wakeup, a
+ *  spurious wakeup, or if \p word did not hold \p expected. */
+inline auto futex_wait(std::atomic<std::uint32_t>& word,
+                       std::uint32_t expected,
+                       std::chrono::nanoseconds timeout,
+                       bool shared = false) noexcept -> bool
+{
+    if (timeout <= std::chrono::nanoseconds::zero())
+        return false;
+    auto const seconds =
+        std::chrono::duration_cast<std::chrono::seconds>(timeout);
+    auto ts    = ::timespec{};
+    ts.tv_sec  = static_cast<::time_t>(seconds.count());
+    ts.tv_nsec = static_cast<long>((timeout - seconds).count());
+    auto* const address = reinterpret_cast<std::uint32_t*>(&word);
+    auto const op       = shared ? FUTEX_WAIT : FUTEX_WAIT_PRIVATE;
+    auto const r = ::syscall(SYS_futex, address, op, expected, &ts, nullptr, 0);
+    return r == 0 || errno != ETIMEDOUT;
+}
+
+/// Wake every thread blocked in futex_wait() on \p word.
+inline void futex_wake_all(std::atomic<std::uint32_t>& word,
+                           bool shared = false) noexcept
+{
+    auto const op = shared ? FUTEX_WAKE : FUTEX_WAKE_PRIVATE;
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), op, INT_MAX,
+              nullptr, nullptr, 0);
+}
+
+}  // namespace sl::detail
+#endif  // SIGNALS_LIGHT_DETAIL_FUTEX_HPP
@@ -0,0 +1,271 @@
+#ifndef SIGNALS_LIGHT_DETAIL_RELOCATING_VECTOR_HPP
+#define SIGNALS_LIGHT_DETAIL_RELOCATING_VECTOR_HPP
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace sl::detail {
+
+/// True if the standard library's std::function, std::vector and
+/// std::weak_ptr can be moved by copying their bytes.
+/** libstdc++ only stores trivially copyable targets inline in a std::function,
+ *  and none of the three point into themselves. libc++ and MSVC's
+ *  std::function point to their own inline buffer, so are not. */
+#if defined(__GLIBCXX__)
+inline constexpr bool std_library_is_relocatable = true;
+#else
+inline constexpr bool std_library_is_relocatable = false;
+#endif
+
+/// True if a T can be moved to new storage by copying its bytes, after which
+/// the old storage is released without running the destructor.
+/** Specialized next to each library type that qualifies. */
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+template <typename A, typename B>
+struct is_trivially_relocatable<std::pair<A, B>>
+    : std::bool_constant<is_trivially_relocatable<A>::value &&
+                         is_trivially_relocatable<B>::value> {};
+
+/// A std::optional is its value and a flag, on every standard library.
+template <typename T>
+struct is_trivially_relocatable<std::optional<T>>
+    : is_trivially_relocatable<T> {};
+
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v =
+    is_trivially_relocatable<T>::value;
+
+/// A std::vector subset that grows and erases by relocating its elements.
+/** Growth copies the elements' bytes to the new buffer, and erase destroys
+ *  the one element and shifts the tail down with memmove, instead of a move
+ *  construction and a destruction per element. Three pointers, as
+ *  std::vector. push_back gives the strong exception guarantee. */
+template <typename T>
+class Relocating_vector {
+    static_assert(is_trivially_relocatable_v<T>,
+                  "Relocating_vector: T must be trivially relocatable.");
+
+   public:
+    using value_type             = T;
+    using size_type              = std::size_t;
+    using iterator               = T*;
+    using const_iterator         = T const*;
+    using reverse_iterator       = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+   public:
+    Relocating_vector() = default;
+
+    Relocating_vector(Relocating_vector const& x) noexcept(false)
+    {
+        if (x.empty())
+            return;
+        begin_ = allocate(x.size());
+        end_   = begin_;
+        cap_   = begin_ + x.size();
+        try {
+            for (auto const& element : x) {
+                ::new (static_cast<void*>(end_)) T(element);
+                ++end_;
+            }
+        }
+        catch (...) {
+            this->release();
+            throw;
+        }
+    }
+
+    Relocating_vector(Relocating_vector&& x) noexcept
+        : begin_{std::exchange(x.begin_, nullptr)},
+          end_{std::exchange(x.end_, nullptr)},
+          cap_{std::exchange(x.cap_, nullptr)}
+    {}
+
+    auto operator=(Relocating_vector const& x) noexcept(false)
+        -> Relocating_vector&
+    {
+        if (this != &x)
+            this->swap(Relocating_vector{x});
+        return *this;
+    }
+
+    auto operator=(Relocating_vector&& x) noexcept -> Relocating_vector&
+    {
+        if (this != &x) {
+            this->release();
+            begin_ = std::exchange(x.begin_, nullptr);
+            end_   = std::exchange(x.end_, nullptr);
+            cap_   = std::exchange(x.cap_, nullptr);
+        }
+        return *this;
+    }
+
+    ~Relocating_vector() { this->release(); }
+
+   public:
+    /// Append \p x, relocating the existing elements if full.
+    void push_back(T const& x) noexcept(false) { this->emplace_back(x); }
+
+    /// Append \p x, relocating the existing elements if full.
+    void push_back(T&& x) noexcept(false) { this->emplace_back(std::move(x)); }
+
+    /// Construct an element at the end, relocating the others if full.
+    /** \p args may refer to an element of *this. */
+    template <typename... Arguments>
+    auto emplace_back(Arguments&&... args) noexcept(false) -> T&
+    {
+        if (end_ != cap_) {
+            ::new (static_cast<void*>(end_))
+                T(std::forward<Arguments>(args)...);
+            return *end_++;
+        }
+        auto const count    = this->size();
+        auto const capacity = count == 0 ? size_type{1} : 2 * count;
+        auto* const buffer  = allocate(capacity);
+        try {
+            ::new (static_cast<void*>(buffer + count))
+                T(std::forward<Arguments>(args)...);
+        }
+        catch (...) {
+            std::allocator<T>{}.deallocate(buffer, capacity);
+            throw;
+        }
+        if (count != 0)
+            std::memcpy(static_cast<void*>(buffer), begin_, count * sizeof(T));
+        this->deallocate();
+        begin_ = buffer;
+        end_   = buffer + count + 1;
+        cap_   = buffer + capacity;
+        return *(end_ - 1);
+    }
+
+    /// Destroy the element at \p pos and relocate the following ones down.
+    /** Returns an iterator to the element that followed \p pos. */
+    auto erase(const_iterator pos) noexcept -> iterator
+    {
+        auto* const p = begin_ + (pos - begin_);
+        p->~T();
+        std::memmove(static_cast<void*>(p), p + 1, (end_ - p - 1) * sizeof(T));
+        --end_;
+        return p;
+    }
+
+    /// Destroy [first, last) and relocate the following elements down.
+    /** Returns an iterator to the element that followed the range. */
+    auto erase(const_iterator first, const_iterator last) noexcept -> iterator
+    {
+        auto* const p = begin_ + (first - begin_);
+        auto* const q = begin_ + (last - begin_);
+        if (p == q)
+            return p;
+        std::destroy(p, q);
+        std::memmove(static_cast<void*>(p), q, (end_ - q) * sizeof(T));
+        end_ -= q - p;
+        return p;
+    }
+
+    void clear() noexcept
+    {
+        std::destroy(begin_, end_);
+        end_ = begin_;
+    }
+
+    void swap(Relocating_vector& x) noexcept
+    {
+        std::swap(begin_, x.begin_);
+        std::swap(end_, x.end_);
+        std::swap(cap_, x.cap_);
+    }
+
+    void swap(Relocating_vector&& x) noexcept { this->swap(x); }
+
+   public:
+    auto size() const noexcept -> size_type
+    {
+        return static_cast<size_type>(end_ - begin_);
+    }
+
+    auto capacity() const noexcept -> size_type
+    {
+        return static_cast<size_type>(cap_ - begin_);
+    }
+
+    auto empty() const noexcept -> bool { return begin_ == end_; }
+
+    auto operator[](size_type i) noexcept -> T& { return begin_[i]; }
+    auto operator[](size_type i) const noexcept -> T const&
+    {
+        return begin_[i];
+    }
+
+    auto front() noexcept -> T& { return *begin_; }
+    auto front() const noexcept -> T const& { return *begin_; }
+
+    auto back() noexcept -> T& { return *(end_ - 1); }
+    auto back() const noexcept -> T const& { return *(end_ - 1); }
+
+    auto begin() noexcept -> iterator { return begin_; }
+    auto begin() const noexcept -> const_iterator { return begin_; }
+
+    auto end() noexcept -> iterator { return end_; }
+    auto end() const noexcept -> const_iterator { return end_; }
+
+    auto rbegin() noexcept -> reverse_iterator
+    {
+        return reverse_iterator{end_};
+    }
+    auto rbegin() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator{end_};
+    }
+
+    auto rend() noexcept -> reverse_iterator
+    {
+        return reverse_iterator{begin_};
+    }
+    auto rend() const noexcept -> const_reverse_iterator
+    {
+        return const_reverse_iterator{begin_};
+    }
+
+   private:
+    T* begin_ = nullptr;
+    T* end_   = nullptr;
+    T* cap_   = nullptr;
+
+   private:
+    static auto allocate(size_type n) noexcept(false) -> T*
+    {
+        return std::allocator<T>{}.allocate(n);
+    }
+
+    void deallocate() noexcept
+    {
+        if (begin_ != nullptr)
+            std::allocator<T>{}.deallocate(begin_, this->capacity());
+    }
+
+    void release() noexcept
+    {
+        std::destroy(begin_, end_);
+        this->deallocate();
+        begin_ = end_ = cap_ = nullptr;
+    }
+};
+
+/// Relocating_vector<T> if T is trivially relocatable, std::vector otherwise.
+template <typename T>
+using Slot_vector_t = std::conditional_t<is_trivially_relocatable_v<T>,
+                                         Relocating_vector<T>,
+                                         std::vector<T>>;
+
+}  // namespace sl::detail
+#endif  // SIGNALS_LIGHT_DETAIL_RELOCATING_VECTOR_HPP
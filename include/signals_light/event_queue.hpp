@@ -0,0 +1,437 @@
+#ifndef SIGNALS_LIGHT_EVENT_QUEUE_HPP
+#define SIGNALS_LIGHT_EVENT_QUEUE_HPP
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+#include <signals_light/signal.hpp>
+
+namespace sl::detail {
+
+/// Return a new non-blocking eventfd, throws std::system_error on failure.
+inline auto make_eventfd(char const* what) noexcept(false) -> int
+{
+    auto const fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (fd == -1)
+        throw std::system_error{errno, std::system_category(), what};
+    return fd;
+}
+
+/// Make \p fd readable.
+inline void signal_eventfd(int fd) noexcept
+{
+    auto const one                = std::uint64_t{1};
+    [[maybe_unused]] auto const r = ::write(fd, &one, sizeof(one));
+}
+
+/// Reset \p fd to non-readable.
+inline void clear_eventfd(int fd) noexcept
+{
+    auto count                    = std::uint64_t{0};
+    [[maybe_unused]] auto const r = ::read(fd, &count, sizeof(count));
+}
+
+}  // namespace sl::detail
+
+namespace sl {
+
+/// Multi-producer, single-consumer queue of tasks with an eventfd wakeup.
+/** Any thread can post(), a single consumer thread calls process_events().
+ *  The eventfd returned by fd() becomes readable when tasks are pending, it is
+ *  written once per empty-to-non-empty transition, so many posts between two
+ *  process_events() calls cost a single wakeup. Linux only. */
+class Event_queue {
+   public:
+    using Task = std::function<void()>;
+
+   public:
+    /// Create an empty queue and its eventfd.
+    /** Throws std::system_error if the eventfd can't be created. */
+    Event_queue() noexcept(false)
+        : fd_{detail::make_eventfd("Event_queue: eventfd")}
+    {}
+
+    Event_queue(Event_queue const&) = delete;
+    Event_queue(Event_queue&&)      = delete;
+    auto operator=(Event_queue const&) -> Event_queue& = delete;
+    auto operator=(Event_queue&&) -> Event_queue& = delete;
+
+    /// Discards any tasks that have not been processed.
+    ~Event_queue()
+    {
+        delete_list(head_.exchange(nullptr, std::memory_order_acquire));
+        delete_list(batch_);
+        ::close(fd_);
+    }
+
+   public:
+    /// Return the eventfd, readable while tasks are pending.
+    /** Register it with EPOLLIN in an existing epoll loop, and call
+     *  process_events() when it is reported readable. */
+    auto fd() const noexcept -> int { return fd_; }
+
+    /// Append \p task to the queue, can be called from any thread.
+    /** Lock-free, the eventfd is only written if the queue was empty. */
+    void post(Task task) noexcept(false)
+    {
+        auto* const node = new Node{std::move(task), nullptr};
+        auto* head       = head_.load(std::memory_order_relaxed);
+        do {
+            node->next = head;
+        } while (!head_.compare_exchange_weak(head, node,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed));
+        if (head == nullptr)
+            detail::signal_eventfd(fd_);
+    }
+
+    /// Run all tasks that are pending, in the order they were posted.
+    /** Must only be called from the consumer thread. Returns the number of
+     *  tasks run. If a task throws, the rest of the batch is kept and the
+     *  eventfd is signalled again, so the next call continues with it. */
+    auto process_events() noexcept(false) -> std::size_t
+    {
+        // The eventfd is cleared before the queue is taken, a post() racing
+        // with this call either lands in this batch or signals again.
+        detail::clear_eventfd(fd_);
+
+        // Pushed in LIFO order, reversed onto the tail of any leftover batch.
+        auto* node = head_.exchange(nullptr, std::memory_order_acquire);
+        auto* reversed = static_cast<Node*>(nullptr);
+        while (node != nullptr) {
+            auto* const next = node->next;
+            node->next       = reversed;
+            reversed         = node;
+            node             = next;
+        }
+        append_to_batch(reversed);
+
+        auto ran = std::size_t{0};
+        while (batch_ != nullptr) {
+            auto const current = std::unique_ptr<Node>{batch_};
+            batch_             = batch_->next;
+            try {
+                current->task();
+            }
+            catch (...) {
+                if (batch_ != nullptr)
+                    detail::signal_eventfd(fd_);
+                throw;
+            }
+            ++ran;
+        }
+        return ran;
+    }
+
+    /// Return true if there are no tasks waiting to be processed.
+    /** Only a snapshot if other threads are posting concurrently. */
+    auto is_empty() const noexcept -> bool
+    {
+        return batch_ == nullptr &&
+               head_.load(std::memory_order_relaxed) == nullptr;
+    }
+
+   private:
+    struct Node {
+        Task task;
+        Node* next;
+    };
+
+    std::atomic<Node*> head_ = nullptr;
+    Node* batch_             = nullptr;  // Consumer side, in FIFO order.
+    int fd_;
+
+   private:
+    void append_to_batch(Node* list) noexcept
+    {
+        if (batch_ == nullptr) {
+            batch_ = list;
+            return;
+        }
+        auto* tail = batch_;
+        while (tail->next != nullptr)
+            tail = tail->next;
+        tail->next = list;
+    }
+
+    static void delete_list(Node* node) noexcept
+    {
+        while (node != nullptr)
+            delete std::exchange(node, node->next);
+    }
+};
+
+/// What a Bounded_event_queue does with a post() when it is full.
+enum class Overflow {
+    Block,        // Wait in post() until the consumer makes room.
+    Drop_newest,  // Discard the task being posted.
+    Drop_oldest,  // Discard the oldest pending task to make room.
+    Coalesce      // Keyed posts replace a pending task with the same key,
+                  // otherwise the task being posted is discarded when full.
+};
+
+/// Multi-producer, single-consumer task queue with a fixed capacity.
+/** Same eventfd protocol as Event_queue, but at most capacity() tasks are
+ *  pending, the Overflow policy decides what happens to further posts. Posts
+ *  take a mutex, tasks run outside of it. Linux only. */
+class Bounded_event_queue {
+   public:
+    using Task = std::function<void()>;
+    using Key  = std::uint64_t;
+
+   public:
+    /// Create an empty queue holding at most \p capacity pending tasks.
+    /** Throws std::invalid_argument if \p capacity is zero, and
+     *  std::system_error if the eventfd can't be created. */
+    Bounded_event_queue(std::size_t capacity, Overflow policy) noexcept(false)
+        : policy_{policy},
+          ring_(sanitize(capacity)),
+          fd_{detail::make_eventfd("Bounded_event_queue: eventfd")}
+    {
+        // A kept tail is run before the ring is taken, so never more.
+        batch_.reserve(capacity);
+        if (policy_ == Overflow::Coalesce)
+            keys_.reserve(capacity);
+    }
+
+    Bounded_event_queue(Bounded_event_queue const&) = delete;
+    Bounded_event_queue(Bounded_event_queue&&)      = delete;
+    auto operator=(Bounded_event_queue const&) -> Bounded_event_queue& = delete;
+    auto operator=(Bounded_event_queue&&) -> Bounded_event_queue& = delete;
+
+    /// Discards any tasks that have not been processed.
+    ~Bounded_event_queue() { ::close(fd_); }
+
+   public:
+    /// Return the eventfd, readable while tasks are pending.
+    auto fd() const noexcept -> int { return fd_; }
+
+    /// Append \p task, can be called from any thread.
+    /** Returns false if \p task was discarded. With Overflow::Block this waits
+     *  for room, so it must not be called from the consumer thread. */
+    auto post(Task task) noexcept(false) -> bool
+    {
+        return this->push(std::nullopt, std::move(task));
+    }
+
+    /// Append \p task, replacing a pending task posted with the same \p key.
+    /** Keys are only used with Overflow::Coalesce, other policies treat this
+     *  as post(task). Returns false if \p task was discarded. */
+    auto post(Key key, Task task) noexcept(false) -> bool
+    {
+        return this->push(key, std::move(task));
+    }
+
+    /// Run all pending tasks, in the order they were posted.
+    /** Must only be called from the consumer thread. Returns the number of
+     *  tasks run. If a task throws, the rest of the batch is kept and the
+     *  eventfd is signalled again, so the next call runs it first, before
+     *  taking any new tasks. Kept tasks have left the queue and no longer
+     *  count toward its capacity. */
+    auto process_events() noexcept(false) -> std::size_t
+    {
+        auto const kept = this->run_batch();
+        detail::clear_eventfd(fd_);
+        {
+            auto const lock = std::lock_guard{mtx_};
+            for (; count_ != 0; --count_) {
+                batch_.push_back(std::move(ring_[head_]));
+                head_ = (head_ + 1) % ring_.size();
+            }
+            keys_.clear();
+        }
+        not_full_.notify_all();
+        return kept + this->run_batch();
+    }
+
+    /// Return the maximum number of pending tasks.
+    auto capacity() const noexcept -> std::size_t { return ring_.size(); }
+
+    /// Return the number of pending tasks, a snapshot.
+    auto size() const noexcept -> std::size_t
+    {
+        auto const lock = std::lock_guard{mtx_};
+        return count_;
+    }
+
+    /// Return the Overflow policy given at construction.
+    auto policy() const noexcept -> Overflow { return policy_; }
+
+    /// Return the number of tasks discarded because the queue was full.
+    auto dropped() const noexcept -> std::uint64_t
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /// Return the number of tasks that replaced a pending task with its key.
+    auto coalesced() const noexcept -> std::uint64_t
+    {
+        return coalesced_.load(std::memory_order_relaxed);
+    }
+
+   private:
+    Overflow const policy_;
+    mutable std::mutex mtx_;
+    std::condition_variable not_full_;
+    std::vector<Task> ring_;
+    std::size_t head_     = 0;
+    std::size_t count_    = 0;
+    std::uint64_t pushed_ = 0;  // Sequence number of the next entry.
+    std::unordered_map<Key, std::uint64_t> keys_;  // Pending key -> sequence.
+    std::vector<Task> batch_;                      // Consumer side.
+    std::size_t next_                     = 0;  // Next task of batch_ to run.
+    std::atomic<std::uint64_t> dropped_   = 0;
+    std::atomic<std::uint64_t> coalesced_ = 0;
+    int fd_;
+
+   private:
+    /// Run batch_ from next_, keeping the rest and signalling on a throw.
+    auto run_batch() noexcept(false) -> std::size_t
+    {
+        auto ran = std::size_t{0};
+        while (next_ != batch_.size()) {
+            auto const task = std::move(batch_[next_++]);
+            try {
+                task();
+            }
+            catch (...) {
+                if (next_ != batch_.size())
+                    detail::signal_eventfd(fd_);
+                throw;
+            }
+            ++ran;
+        }
+        batch_.clear();
+        next_ = 0;
+        return ran;
+    }
+
+    auto push(std::optional<Key> key, Task task) noexcept(false) -> bool
+    {
+        auto lock = std::unique_lock{mtx_};
+        if (key.has_value() && policy_ == Overflow::Coalesce) {
+            auto const iter = keys_.find(*key);
+            if (iter != std::end(keys_)) {
+                auto const offset = count_ - (pushed_ - iter->second);
+                ring_[(head_ + offset) % ring_.size()] = std::move(task);
+                coalesced_.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+        if (count_ == ring_.size()) {
+            switch (policy_) {
+                case Overflow::Block:
+                    not_full_.wait(lock,
+                                   [this] { return count_ < ring_.size(); });
+                    break;
+                case Overflow::Drop_oldest:
+                    ring_[head_] = nullptr;
+                    head_        = (head_ + 1) % ring_.size();
+                    --count_;
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    break;
+                case Overflow::Drop_newest:
+                case Overflow::Coalesce:
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+            }
+        }
+        ring_[(head_ + count_) % ring_.size()] = std::move(task);
+        if (key.has_value() && policy_ == Overflow::Coalesce)
+            keys_[*key] = pushed_;
+        ++pushed_;
+        if (++count_ == 1)
+            detail::signal_eventfd(fd_);
+        return true;
+    }
+
+    /// Throws std::invalid_argument if \p capacity is zero.
+    static auto sanitize(std::size_t capacity) noexcept(false) -> std::size_t
+    {
+        auto constexpr message = "Bounded_event_queue: capacity of zero.";
+        return capacity == 0 ? throw std::invalid_argument{message} : capacity;
+    }
+};
+
+namespace detail {
+
+/// Return a task that calls \p target with a copy of \p args, if not expired.
+template <typename... Args, typename... Arguments>
+auto make_delivery(std::shared_ptr<Slot<void(Args...)> const> target,
+                   Arguments&&... args) -> std::function<void()>
+{
+    return [target = std::move(target),
+            packed = std::tuple<std::decay_t<Args>...>{
+                std::forward<Arguments>(args)...}] {
+        if (target->is_expired())
+            return;
+        std::apply(target->slot_function(), packed);
+    };
+}
+
+}  // namespace detail
+
+/// Return a Slot that defers each invocation of \p s to \p queue.
+/** The arguments are copied when the returned Slot is invoked, and \p s is
+ *  called with them from the thread running Event_queue::process_events().
+ *  Lifetimes tracked by \p s are checked at delivery, expired Slots are not
+ *  called. \p queue must outlive the returned Slot. */
+template <typename... Args>
+auto queued(Event_queue& queue, Slot<void(Args...)> s) -> Slot<void(Args...)>
+{
+    auto target = std::make_shared<Slot<void(Args...)> const>(std::move(s));
+    return [&queue, target = std::move(target)](Args... args) {
+        queue.post(detail::make_delivery(target, std::forward<Args>(args)...));
+    };
+}
+
+/// Return a Slot that defers each invocation of \p s to a bounded \p queue.
+/** Emissions that overflow \p queue are handled by its Overflow policy. */
+template <typename... Args>
+auto queued(Bounded_event_queue& queue, Slot<void(Args...)> s)
+    -> Slot<void(Args...)>
+{
+    auto target = std::make_shared<Slot<void(Args...)> const>(std::move(s));
+    return [&queue, target = std::move(target)](Args... args) {
+        queue.post(detail::make_delivery(target, std::forward<Args>(args)...));
+    };
+}
+
+/// Return a Slot that defers invocations of \p s, coalesced by key.
+/** \p key_fn is invoked with the emitted arguments and returns a
+ *  Bounded_event_queue::Key, a pending delivery with the same key is replaced
+ *  if \p queue uses Overflow::Coalesce. */
+template <typename... Args, typename Key_fn>
+auto queued(Bounded_event_queue& queue, Slot<void(Args...)> s, Key_fn key_fn)
+    -> Slot<void(Args...)>
+{
+    static_assert(std::is_invocable_r_v<Bounded_event_queue::Key, Key_fn,
+                                        Args const&...>,
+                  "queued: Key_fn must return a Bounded_event_queue::Key.");
+    auto target = std::make_shared<Slot<void(Args...)> const>(std::move(s));
+    return [&queue, target = std::move(target),
+            key_fn = std::move(key_fn)](Args... args) {
+        auto const key = key_fn(std::as_const(args)...);
+        queue.post(key,
+                   detail::make_delivery(target, std::forward<Args>(args)...));
+    };
+}
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_EVENT_QUEUE_HPP
@@ -0,0 +1,156 @@
+#ifndef SIGNALS_LIGHT_FILTER_SIGNAL_HPP
+#define SIGNALS_LIGHT_FILTER_SIGNAL_HPP
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <signals_light/signal.hpp>
+
+namespace sl {
+
+/// The order a Filter_signal tries its Slots in.
+enum class Slot_order {
+    Connection,  // The order the Slots were connected in.
+    Adaptive,    // Most frequent handlers first, order does not matter.
+};
+
+template <typename Signature>
+class Filter_signal;
+
+/// A short-circuiting Signal, emission stops at the first Slot returning true.
+/** Suited to event filter chains, where a Slot returns true if it handled the
+ *  event. With Slot_order::Adaptive, the number of events each Slot handled is
+ *  counted, and every reorder_period emits the Slots are stably sorted so the
+ *  most frequent handlers are tried first. Counts are halved at each reorder,
+ *  so the order follows changes in the event mix. A reorder due during a
+ *  reentrant emit is left to the next emit that is not nested in another. */
+template <typename... Args>
+class Filter_signal<bool(Args...)> {
+   public:
+    using Signature_t = bool(Args...);
+
+   public:
+    /// Construct with no connected Slots.
+    /** Throws std::invalid_argument if \p reorder_period is zero. */
+    explicit Filter_signal(
+        Slot_order order             = Slot_order::Connection,
+        std::uint32_t reorder_period = 1'024) noexcept(false)
+        : order_{order}, reorder_period_{reorder_period}
+    {
+        if (reorder_period == 0)
+            throw std::invalid_argument{"Filter_signal: reorder period zero."};
+    }
+
+   public:
+    /// Invoke non-expired Slots in order until one returns true.
+    /** Returns true if a Slot handled the emission. Expired Slots are
+     *  ignored. Slots must not be connected or disconnected from a Slot. */
+    auto emit(Param_t<Args>... args) const -> bool
+    {
+        auto const adaptive = order_ == Slot_order::Adaptive;
+        if (adaptive && ++emits_ >= reorder_period_ && depth_ == 0)
+            this->reorder();
+        auto const scope = detail::Emission_scope{};
+        auto const depth = Depth_scope{depth_};
+        for (auto& entry : slots_) {
+            if (entry.slot.is_expired())
+                continue;
+            if (entry.slot.slot_function()(args...)) {
+                if (adaptive)
+                    ++entry.hits;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Alternative notation for Filter_signal::emit.
+    auto operator()(Param_t<Args>... args) const -> bool
+    {
+        return this->emit(args...);
+    }
+
+    /// Register a Slot with *this, tried after the Slots already connected.
+    /** Returns a unique Identifier, to be used with disconnect. */
+    auto connect(Slot<Signature_t> s) noexcept(false) -> Identifier
+    {
+        auto const id = next_id_;
+        slots_.push_back({id, std::move(s), 0});
+        next_id_ = Identifier::next(id);
+        return id;
+    }
+
+    /// Removes and returns the Slot associated with the given Identifier.
+    /** Throws std::invalid_argument if no connected Slot is found with id. */
+    auto disconnect(Identifier id) noexcept(false) -> Slot<Signature_t>
+    {
+        auto const iter =
+            std::find_if(std::begin(slots_), std::end(slots_),
+                         [id](auto const& entry) { return entry.id == id; });
+        if (iter == std::end(slots_)) {
+            throw std::invalid_argument{
+                "Filter_signal::disconnect: No matching id."};
+        }
+        auto slot = std::move(iter->slot);
+        slots_.erase(iter);
+        return slot;
+    }
+
+    /// Return the number of connected Slots.
+    auto slot_count() const noexcept -> std::size_t { return slots_.size(); }
+
+    /// Return true if there are no connected Slots.
+    auto is_empty() const noexcept -> bool { return slots_.empty(); }
+
+    /// Return the order Slots are tried in.
+    auto order() const noexcept -> Slot_order { return order_; }
+
+   private:
+    struct Entry {
+        Identifier id;
+        Slot<Signature_t> slot;
+        std::uint32_t hits;
+    };
+
+    mutable std::vector<Entry> slots_;
+    Slot_order order_;
+    std::uint32_t reorder_period_;
+    mutable std::uint32_t emits_ = 0;
+    mutable std::uint32_t depth_ = 0;  // Emits in progress, slots_ is in use.
+    Identifier next_id_;  // Slots are reordered, so not slots_.back().
+
+   private:
+    /// Counts an emit in progress for as long as it is alive.
+    class Depth_scope {
+       public:
+        explicit Depth_scope(std::uint32_t& depth) noexcept : depth_{depth}
+        {
+            ++depth_;
+        }
+
+        Depth_scope(Depth_scope const&) = delete;
+        auto operator=(Depth_scope const&) -> Depth_scope& = delete;
+
+        ~Depth_scope() { --depth_; }
+
+       private:
+        std::uint32_t& depth_;
+    };
+
+    /// Sort by decayed hit count, most first, keeping ties in place.
+    void reorder() const
+    {
+        emits_ = 0;
+        std::stable_sort(
+            std::begin(slots_), std::end(slots_),
+            [](auto const& a, auto const& b) { return a.hits > b.hits; });
+        for (auto& entry : slots_)
+            entry.hits /= 2;
+    }
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_FILTER_SIGNAL_HPP
@@ -0,0 +1,181 @@
+#ifndef SIGNALS_LIGHT_MEMOIZING_SIGNAL_HPP
+#define SIGNALS_LIGHT_MEMOIZING_SIGNAL_HPP
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <signals_light/signal.hpp>
+
+namespace sl {
+
+template <typename Signature>
+class Memoizing_signal;
+
+/// A Signal of pure Slots that caches emit results by argument.
+/** The result of an emission is kept in a bounded LRU cache, keyed by the
+ *  emitted arguments, which must be equality comparable and have a std::hash
+ *  specialization. An emit with cached arguments returns the cached result
+ *  without invoking any Slot. The cache is cleared by connect, disconnect,
+ *  purge_expired and disconnect_all. An expiry can't be seen without
+ *  scanning every Slot, so while any connected Slot tracks a Lifetime emits
+ *  are not cached. Only correct if every Slot's result depends on the
+ *  arguments alone. Connecting or disconnecting through a reference to the
+ *  Signal base class does not clear the cache, pass *this itself to a
+ *  Signal_base. */
+template <typename R, typename... Args>
+class Memoizing_signal<R(Args...)> : public Signal<R(Args...)> {
+    static_assert(!std::is_same_v<void, R>,
+                  "Memoizing_signal: Only signals with a result are cached.");
+
+   public:
+    using Signature_t   = R(Args...);
+    using Emit_result_t = std::optional<R>;
+    using Key_t         = std::tuple<std::decay_t<Args>...>;
+
+   public:
+    /// Cache the results of up to \p capacity distinct arguments.
+    /** Throws std::invalid_argument if \p capacity is zero. */
+    explicit Memoizing_signal(std::size_t capacity = 64) noexcept(false)
+        : capacity_{capacity}
+    {
+        if (capacity == 0)
+            throw std::invalid_argument{"Memoizing_signal: capacity of zero."};
+    }
+
+    /// Copies the connected Slots, the cache starts empty.
+    Memoizing_signal(Memoizing_signal const& x)
+        : Signal<R(Args...)>{x}, capacity_{x.capacity_}, tracked_{x.tracked_}
+    {}
+
+    Memoizing_signal(Memoizing_signal&&) = delete;
+    auto operator=(Memoizing_signal const&) -> Memoizing_signal& = delete;
+    auto operator=(Memoizing_signal&&) -> Memoizing_signal& = delete;
+
+   public:
+    /// Return the cached result for \p args, or emit and cache it.
+    /** Emits without caching while any connected Slot tracks a Lifetime. */
+    auto emit(Param_t<Args>... args) const -> Emit_result_t
+    {
+        if (tracked_ != 0) {
+            ++misses_;
+            return Signal<R(Args...)>::emit(args...);
+        }
+        auto key = Key_t{args...};
+        if (auto const found = index_.find(key); found != std::end(index_)) {
+            ++hits_;
+            entries_.splice(std::begin(entries_), entries_, found->second);
+            return found->second->second;
+        }
+        ++misses_;
+        auto result = Signal<R(Args...)>::emit(args...);
+        if (entries_.size() == capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+        entries_.emplace_front(std::move(key), result);
+        index_.emplace(std::cref(entries_.front().first), std::begin(entries_));
+        return result;
+    }
+
+    /// Alternative notation for Memoizing_signal::emit.
+    auto operator()(Param_t<Args>... args) const -> Emit_result_t
+    {
+        return this->emit(args...);
+    }
+
+    /// Register a Slot with *this and clear the cache.
+    auto connect(Slot<Signature_t> s) noexcept(false) -> Identifier
+    {
+        this->invalidate();
+        auto const is_tracked = s.is_tracked();
+        auto const id         = Signal<R(Args...)>::connect(std::move(s));
+        tracked_ += is_tracked ? 1 : 0;
+        return id;
+    }
+
+    /// Remove the Slot associated with \p id and clear the cache.
+    /** Throws std::invalid_argument if no connected Slot is found with id. */
+    auto disconnect(Identifier id) noexcept(false) -> Slot<Signature_t>
+    {
+        auto slot = Signal<R(Args...)>::disconnect(id);
+        this->invalidate();
+        tracked_ -= slot.is_tracked() ? 1 : 0;
+        return slot;
+    }
+
+    /// Disconnect every expired Slot and clear the cache.
+    /** Returns the number of Slots disconnected. */
+    auto purge_expired() noexcept -> std::size_t
+    {
+        auto const count = Signal<R(Args...)>::purge_expired();
+        this->invalidate();
+        tracked_ -= count;  // Only a tracked Slot can expire.
+        return count;
+    }
+
+    /// Disconnect every Slot and clear the cache.
+    void disconnect_all() noexcept
+    {
+        Signal<R(Args...)>::disconnect_all();
+        this->invalidate();
+        tracked_ = 0;
+    }
+
+    /// Clear the cache, needed if a Slot's results change for other reasons.
+    void invalidate() const noexcept
+    {
+        index_.clear();
+        entries_.clear();
+    }
+
+    /// Return the number of cached results.
+    auto cache_size() const noexcept -> std::size_t { return entries_.size(); }
+
+    /// Return the maximum number of cached results.
+    auto capacity() const noexcept -> std::size_t { return capacity_; }
+
+    /// Return the number of emits answered from the cache.
+    auto hit_count() const noexcept -> std::uint64_t { return hits_; }
+
+    /// Return the number of emits that invoked the Slots.
+    auto miss_count() const noexcept -> std::uint64_t { return misses_; }
+
+   private:
+    struct Key_hash {
+        auto operator()(Key_t const& key) const -> std::size_t
+        {
+            return std::apply(
+                [](auto const&... xs) {
+                    auto seed = std::size_t{0};
+                    ((seed ^= std::hash<std::decay_t<decltype(xs)>>{}(xs) +
+                              0x9e3779b9 + (seed << 6) + (seed >> 2)),
+                     ...);
+                    return seed;
+                },
+                key);
+        }
+    };
+
+    using Entries_t = std::list<std::pair<Key_t, Emit_result_t>>;
+
+    std::size_t capacity_;
+    mutable Entries_t entries_;  // Most recently used first.
+    mutable std::unordered_map<std::reference_wrapper<Key_t const>,
+                               typename Entries_t::iterator,
+                               Key_hash,
+                               std::equal_to<Key_t>>
+        index_;
+    std::size_t tracked_          = 0;  // Connected Slots tracking a Lifetime.
+    mutable std::uint64_t hits_   = 0;
+    mutable std::uint64_t misses_ = 0;
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_MEMOIZING_SIGNAL_HPP
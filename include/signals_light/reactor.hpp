@@ -0,0 +1,186 @@
+#ifndef SIGNALS_LIGHT_REACTOR_HPP
+#define SIGNALS_LIGHT_REACTOR_HPP
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <signals_light/signal.hpp>
+
+namespace sl {
+
+/// Readiness reported to Fd_signal Slots, a bitmask.
+enum class Fd_events : std::uint32_t {
+    None     = 0,
+    Readable = EPOLLIN,
+    Writable = EPOLLOUT,
+    Hangup   = EPOLLHUP | EPOLLRDHUP,
+    Error    = EPOLLERR,
+};
+
+/// Return the union of the two event sets.
+inline auto operator|(Fd_events x, Fd_events y) noexcept -> Fd_events
+{
+    return static_cast<Fd_events>(static_cast<std::uint32_t>(x) |
+                                  static_cast<std::uint32_t>(y));
+}
+
+/// Return the intersection of the two event sets.
+inline auto operator&(Fd_events x, Fd_events y) noexcept -> Fd_events
+{
+    return static_cast<Fd_events>(static_cast<std::uint32_t>(x) &
+                                  static_cast<std::uint32_t>(y));
+}
+
+/// Return true if any of the events in \p y are set in \p x.
+inline auto has(Fd_events x, Fd_events y) noexcept -> bool
+{
+    return (x & y) != Fd_events::None;
+}
+
+class Fd_signal;
+
+/// Minimal edge-triggered epoll loop that emits Fd_signals. Linux only.
+/** Not thread safe, run_once() and Fd_signal construction/destruction must
+ *  happen on the same thread. */
+class Reactor {
+   public:
+    /// Maximum number of events dispatched per epoll_wait call.
+    static auto constexpr batch_size = std::size_t{64};
+
+   public:
+    /// Create a new epoll instance.
+    /** Throws std::system_error if the epoll instance can't be created. */
+    Reactor() noexcept(false) : epfd_{::epoll_create1(EPOLL_CLOEXEC)}
+    {
+        if (epfd_ == -1)
+            throw std::system_error{errno, std::system_category(),
+                                    "Reactor: epoll_create1"};
+    }
+
+    Reactor(Reactor const&) = delete;
+    Reactor(Reactor&&)      = delete;
+    auto operator=(Reactor const&) -> Reactor& = delete;
+    auto operator=(Reactor&&) -> Reactor& = delete;
+
+    /// All Fd_signals registered with *this must be destroyed first.
+    ~Reactor() { ::close(epfd_); }
+
+   public:
+    /// Return the epoll file descriptor.
+    /** It is readable while events are pending, so a Reactor can be nested in
+     *  another event loop. Events kept after a Slot threw are not reported by
+     *  it, call run_once first while has_kept_events(). */
+    auto fd() const noexcept -> int { return epfd_; }
+
+    /// Wait up to \p timeout_ms for readiness and emit the ready Fd_signals.
+    /** A negative timeout waits indefinitely, zero polls. Returns the number
+     *  of Fd_signals emitted. Throws std::system_error on epoll_wait failure,
+     *  an interrupted wait returns zero. If a Slot throws, the events of the
+     *  batch not yet dispatched are kept, edge-triggered readiness is not
+     *  reported twice. The next call dispatches them first, and polls rather
+     *  than waits for more. */
+    auto run_once(int timeout_ms = -1) noexcept(false) -> std::size_t;
+
+    /// Return true if a Slot threw and left events for the next run_once.
+    auto has_kept_events() const noexcept -> bool { return next_ < pending_; }
+
+   private:
+    friend class Fd_signal;
+
+    int epfd_;
+    std::array<::epoll_event, batch_size> events_;
+    std::size_t pending_ = 0;  // Events in the batch being dispatched.
+    std::size_t next_    = 0;  // Index of the next event to dispatch.
+
+   private:
+    /// Remove \p x from the batch being dispatched, if any.
+    void forget(Fd_signal const* x) noexcept
+    {
+        for (auto i = std::size_t{0}; i < pending_; ++i) {
+            if (events_[i].data.ptr == x)
+                events_[i].data.ptr = nullptr;
+        }
+    }
+};
+
+/// A Signal emitted by a Reactor when a file descriptor becomes ready.
+/** Registration is edge-triggered, Slots should read or write until EAGAIN,
+ *  otherwise the next emission only happens once more data arrives. The file
+ *  descriptor is not owned. Can't be moved, the Reactor holds its address. */
+class Fd_signal : public Signal<void(Fd_events)> {
+   public:
+    /// Register \p fd with \p reactor for the given \p interest.
+    /** Throws std::system_error if epoll_ctl fails. */
+    Fd_signal(Reactor& reactor,
+              int fd,
+              Fd_events interest = Fd_events::Readable) noexcept(false)
+        : reactor_{reactor}, fd_{fd}
+    {
+        auto ev     = ::epoll_event{};
+        ev.events   = static_cast<std::uint32_t>(interest) | EPOLLET;
+        ev.data.ptr = this;
+        if (::epoll_ctl(reactor_.epfd_, EPOLL_CTL_ADD, fd_, &ev) == -1)
+            throw std::system_error{errno, std::system_category(),
+                                    "Fd_signal: epoll_ctl"};
+    }
+
+    Fd_signal(Fd_signal const&) = delete;
+    Fd_signal(Fd_signal&&)      = delete;
+    auto operator=(Fd_signal const&) -> Fd_signal& = delete;
+    auto operator=(Fd_signal&&) -> Fd_signal& = delete;
+
+    /// Unregister from the Reactor, safe to do from within a Slot.
+    ~Fd_signal()
+    {
+        ::epoll_ctl(reactor_.epfd_, EPOLL_CTL_DEL, fd_, nullptr);
+        reactor_.forget(this);
+    }
+
+   public:
+    /// Return the observed file descriptor.
+    auto fd() const noexcept -> int { return fd_; }
+
+   private:
+    Reactor& reactor_;
+    int fd_;
+};
+
+inline auto Reactor::run_once(int timeout_ms) noexcept(false) -> std::size_t
+{
+    // Events kept from a batch a Slot threw from go first, in order.
+    auto const kept = pending_ - next_;
+    std::copy(std::begin(events_) + next_, std::begin(events_) + pending_,
+              std::begin(events_));
+    pending_ = kept;
+    next_    = 0;
+
+    auto const n = ::epoll_wait(epfd_, events_.data() + kept,
+                                static_cast<int>(events_.size() - kept),
+                                kept == 0 ? timeout_ms : 0);
+    if (n == -1 && errno != EINTR)
+        throw std::system_error{errno, std::system_category(),
+                                "Reactor: epoll_wait"};
+    pending_ += n == -1 ? 0 : static_cast<std::size_t>(n);
+
+    auto emitted = std::size_t{0};
+    while (next_ < pending_) {
+        auto const& event  = events_[next_++];
+        auto* const target = static_cast<Fd_signal*>(event.data.ptr);
+        if (target == nullptr)
+            continue;
+        target->emit(static_cast<Fd_events>(event.events));
+        ++emitted;
+    }
+    pending_ = 0;
+    next_    = 0;
+    return emitted;
+}
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_REACTOR_HPP
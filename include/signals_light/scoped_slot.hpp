@@ -0,0 +1,100 @@
+#ifndef SIGNALS_LIGHT_SCOPED_SLOT_HPP
+#define SIGNALS_LIGHT_SCOPED_SLOT_HPP
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <signals_light/signal.hpp>
+
+namespace sl {
+
+template <typename Signature>
+class Function_ref;
+
+/// A non-owning reference to a callable, two pointers wide.
+/** Never allocates, and is trivially copyable, so it fits in the inline
+ *  buffer of a std::function. The referenced callable must outlive every
+ *  copy. Only binds to lvalues, so a temporary can't be referenced. Small
+ *  const reference arguments are copied into the call, see Param_t. */
+template <typename R, typename... Args>
+class Function_ref<R(Args...)> {
+   public:
+    /// Reference \p f, which must be invocable with Args... returning R.
+    template <typename F,
+              typename = std::enable_if_t<
+                  !std::is_same_v<std::remove_cv_t<F>, Function_ref>>>
+    Function_ref(F& f) noexcept
+        : object_{const_cast<void*>(
+              static_cast<void const*>(std::addressof(f)))},
+          call_{[](void* object, detail::Call_param_t<Args>... args) -> R {
+              return (*static_cast<F*>(object))(
+                  std::forward<detail::Call_param_t<Args>>(args)...);
+          }}
+    {
+        static_assert(std::is_invocable_r_v<R, F&, Args...>,
+                      "Function_ref: F is not invocable with Args...");
+    }
+
+   public:
+    /// Invoke the referenced callable.
+    auto operator()(detail::Call_param_t<Args>... args) const -> R
+    {
+        return call_(object_,
+                     std::forward<detail::Call_param_t<Args>>(args)...);
+    }
+
+   private:
+    void* object_;
+    R (*call_)(void*, detail::Call_param_t<Args>...);
+};
+
+/// Connects a borrowed callable to a Signal for the lifetime of *this.
+/** Signal_t is a Signal of any Storage, or a class derived from one, whose
+ *  own connect and disconnect are used. The callable is referenced through a
+ *  Function_ref, not copied, so it must outlive *this. Connecting stores the
+ *  Function_ref inline in the Slot's std::function, the only allocation is
+ *  growth of the Signal's Slot container, which a disconnect leaves in place
+ *  for the next connection. The Signal must outlive *this. If the Slot was
+ *  disconnected early, the destructor does nothing, Identifiers are never
+ *  reused so it can't match another Slot. */
+template <typename Signal_t>
+class Scoped_slot {
+   public:
+    using Signature_t = typename Signal_t::Signature_t;
+
+   public:
+    /// Connect \p f to \p signal until *this is destroyed.
+    template <typename F>
+    Scoped_slot(Signal_t& signal, F& f) noexcept(false)
+        : signal_{signal},
+          id_{signal.connect(Slot<Signature_t>{Function_ref<Signature_t>{f}})}
+    {}
+
+    Scoped_slot(Scoped_slot const&) = delete;
+    Scoped_slot(Scoped_slot&&)      = delete;
+    auto operator=(Scoped_slot const&) -> Scoped_slot& = delete;
+    auto operator=(Scoped_slot&&) -> Scoped_slot& = delete;
+
+    /// Disconnects the Slot, if it is still connected.
+    ~Scoped_slot()
+    {
+        try {
+            signal_.disconnect(id_);
+        }
+        catch (std::invalid_argument const&) {
+            // Already disconnected by the Signal's owner.
+        }
+    }
+
+   public:
+    /// Return the Identifier of the connected Slot.
+    auto id() const noexcept -> Identifier { return id_; }
+
+   private:
+    Signal_t& signal_;
+    Identifier id_;
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_SCOPED_SLOT_HPP
@@ -0,0 +1,223 @@
+#ifndef SIGNALS_LIGHT_SCRATCH_HPP
+#define SIGNALS_LIGHT_SCRATCH_HPP
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace sl {
+
+/// A bump pointer memory resource, everything is freed at once by reset().
+/** Memory is carved from blocks that double in size as they fill. deallocate
+ *  does nothing. If more than one block was used, reset() frees them all and
+ *  the next allocation takes a single block of their combined size, so a
+ *  steady workload settles on one block and no further heap allocations. Can
+ *  back std::pmr containers, such as a std::pmr::string. Not thread safe. */
+class Scratch_arena : public std::pmr::memory_resource {
+   public:
+    /// The first block will hold \p initial_size bytes.
+    /** Throws std::invalid_argument if \p initial_size is zero. */
+    explicit Scratch_arena(std::size_t initial_size = 4'096) noexcept(false)
+        : next_size_{initial_size}
+    {
+        if (initial_size == 0)
+            throw std::invalid_argument{"Scratch_arena: initial size zero."};
+    }
+
+    Scratch_arena(Scratch_arena const&) = delete;
+    Scratch_arena(Scratch_arena&&)      = delete;
+    auto operator=(Scratch_arena const&) -> Scratch_arena& = delete;
+    auto operator=(Scratch_arena&&) -> Scratch_arena& = delete;
+
+    ~Scratch_arena() override { this->release(); }
+
+   public:
+    /// Construct a T in the arena, it is never destroyed.
+    template <typename T, typename... Arguments>
+    auto make(Arguments&&... args) noexcept(false) -> T*
+    {
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "Scratch_arena: T's destructor would never run.");
+        return ::new (this->allocate(sizeof(T), alignof(T)))
+            T(std::forward<Arguments>(args)...);
+    }
+
+    /// Default construct \p n Ts in the arena, they are never destroyed.
+    template <typename T>
+    auto make_array(std::size_t n) noexcept(false) -> T*
+    {
+        static_assert(std::is_trivially_destructible_v<T>,
+                      "Scratch_arena: T's destructor would never run.");
+        auto* const p = static_cast<T*>(this->allocate(n * sizeof(T),
+                                                       alignof(T)));
+        std::uninitialized_default_construct_n(p, n);
+        return p;
+    }
+
+    /// Make all memory available again, invalidating every allocation.
+    void reset() noexcept
+    {
+        used_ = 0;
+        if (head_ != nullptr && head_->next == nullptr) {
+            current_ = head_->data();
+            return;
+        }
+        next_size_ = capacity_;
+        this->release();
+    }
+
+    /// Return the bytes allocated since the last reset, without padding.
+    auto bytes_used() const noexcept -> std::size_t { return used_; }
+
+    /// Return the total size of the blocks currently held.
+    auto capacity() const noexcept -> std::size_t { return capacity_; }
+
+   private:
+    struct alignas(std::max_align_t) Block {
+        Block* next;
+        std::size_t size;  // Bytes following the header.
+
+        auto data() noexcept -> char*
+        {
+            return reinterpret_cast<char*>(this + 1);
+        }
+    };
+
+    Block* head_          = nullptr;  // Most recent block, allocated from.
+    char* current_        = nullptr;
+    char* end_            = nullptr;
+    std::size_t capacity_ = 0;
+    std::size_t used_     = 0;
+    std::size_t next_size_;
+
+   private:
+    auto do_allocate(std::size_t bytes, std::size_t alignment)
+        -> void* override
+    {
+        auto* p = align_up(current_, alignment);
+        if (p == nullptr || p > end_ ||
+            bytes > static_cast<std::size_t>(end_ - p)) {
+            this->grow(bytes + alignment);
+            p = align_up(current_, alignment);
+        }
+        current_ = p + bytes;
+        used_ += bytes;
+        return p;
+    }
+
+    void do_deallocate(void*, std::size_t, std::size_t) override {}
+
+    auto do_is_equal(std::pmr::memory_resource const& x) const noexcept
+        -> bool override
+    {
+        return this == &x;
+    }
+
+    /// Start a new block with room for at least \p bytes.
+    void grow(std::size_t bytes) noexcept(false)
+    {
+        auto const size = std::max(bytes, next_size_);
+        auto* const block =
+            static_cast<Block*>(::operator new(sizeof(Block) + size));
+        block->next = head_;
+        block->size = size;
+        head_       = block;
+        current_    = block->data();
+        end_        = current_ + size;
+        capacity_ += size;
+        next_size_ = 2 * size;
+    }
+
+    void release() noexcept
+    {
+        while (head_ != nullptr)
+            ::operator delete(std::exchange(head_, head_->next));
+        current_  = nullptr;
+        end_      = nullptr;
+        capacity_ = 0;
+    }
+
+    static auto align_up(char* p, std::size_t alignment) noexcept -> char*
+    {
+        auto const x = reinterpret_cast<std::uintptr_t>(p);
+        return reinterpret_cast<char*>((x + alignment - 1) & ~(alignment - 1));
+    }
+};
+
+}  // namespace sl
+
+namespace sl::detail {
+
+/// Emissions in progress on the calling thread.
+struct Emission_state {
+    int depth         = 0;
+    bool scratch_used = false;
+};
+
+/// Constant initialized, so the thread_local needs no guard on each emit.
+inline auto emission_state() noexcept -> Emission_state&
+{
+    thread_local auto state = Emission_state{};
+    return state;
+}
+
+inline auto scratch_arena() -> Scratch_arena&
+{
+    thread_local auto arena = Scratch_arena{};
+    return arena;
+}
+
+/// Marks an emission, resets the scratch arena when the outermost one ends.
+class Emission_scope {
+   public:
+    Emission_scope() noexcept { ++emission_state().depth; }
+
+    Emission_scope(Emission_scope const&) = delete;
+    Emission_scope(Emission_scope&&)      = delete;
+    auto operator=(Emission_scope const&) -> Emission_scope& = delete;
+    auto operator=(Emission_scope&&) -> Emission_scope& = delete;
+
+    ~Emission_scope()
+    {
+        auto& state = emission_state();
+        if (--state.depth == 0 && state.scratch_used) {
+            state.scratch_used = false;
+            scratch_arena().reset();
+        }
+    }
+};
+
+}  // namespace sl::detail
+
+namespace sl {
+
+/// Access to the emission running on the calling thread, from a Slot.
+class Emission_context {
+   public:
+    /// Return the calling thread's Scratch_arena, for Slot temporaries.
+    /** It is reset when the outermost emission on the thread finishes, so
+     *  memory allocated by a Slot lives until then, across nested emissions.
+     *  Outside of an emission, memory lives until the next emission ends. */
+    static auto scratch() -> Scratch_arena&
+    {
+        detail::emission_state().scratch_used = true;
+        return detail::scratch_arena();
+    }
+
+    /// Return the number of nested emissions running on the calling thread.
+    static auto depth() noexcept -> int
+    {
+        return detail::emission_state().depth;
+    }
+
+    /// Return true if called from within an emission.
+    static auto is_emitting() noexcept -> bool { return depth() > 0; }
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_SCRATCH_HPP
@@ -0,0 +1,224 @@
+#ifndef SIGNALS_LIGHT_SHARED_ARGS_HPP
+#define SIGNALS_LIGHT_SHARED_ARGS_HPP
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <signals_light/event_queue.hpp>
+#include <signals_light/signal.hpp>
+
+namespace sl {
+
+/// Reference counted, immutable copy of a Signal's arguments.
+/** The arguments are copied once into a pooled block, copying a Shared_args
+ *  only increments a reference count, so any number of deferred invocations
+ *  can share one emission's arguments regardless of their size. Can be copied
+ *  and destroyed from any thread. The copies are passed on as const lvalues,
+ *  so Args can't include non-const references, such as Widget&: one deferred
+ *  invocation can't be allowed to modify what the others receive. */
+template <typename... Args>
+class Shared_args {
+    static_assert((std::is_convertible_v<std::decay_t<Args> const&, Args> &&
+                   ...),
+                  "Shared_args: arguments are shared immutable copies, take "
+                  "them by value or by const reference.");
+
+   public:
+    using Tuple_t = std::tuple<std::decay_t<Args>...>;
+
+   public:
+    /// Copy \p args into a new block.
+    template <typename... Arguments>
+    static auto make(Arguments&&... args) noexcept(false) -> Shared_args
+    {
+        auto* const storage = pool().allocate();
+        try {
+            return Shared_args{::new (storage)
+                                   Block{std::forward<Arguments>(args)...}};
+        }
+        catch (...) {
+            pool().deallocate(storage);
+            throw;
+        }
+    }
+
+    /// Shares the block of \p x.
+    Shared_args(Shared_args const& x) noexcept : block_{x.block_}
+    {
+        if (block_ != nullptr)
+            block_->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /// Leaves the moved from Shared_args empty.
+    Shared_args(Shared_args&& x) noexcept
+        : block_{std::exchange(x.block_, nullptr)}
+    {}
+
+    auto operator=(Shared_args x) noexcept -> Shared_args&
+    {
+        std::swap(block_, x.block_);
+        return *this;
+    }
+
+    /// Returns the block to the pool if this is the last reference.
+    ~Shared_args()
+    {
+        if (block_ == nullptr ||
+            block_->refs.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+        block_->~Block();
+        pool().deallocate(block_);
+    }
+
+   public:
+    /// Return the stored arguments, undefined if *this has been moved from.
+    auto get() const noexcept -> Tuple_t const& { return block_->values; }
+
+    /// Invoke \p f with the stored arguments.
+    template <typename F>
+    auto apply(F&& f) const -> decltype(auto)
+    {
+        return std::apply(std::forward<F>(f), block_->values);
+    }
+
+    /// Return the number of Shared_args sharing the block, zero if empty.
+    auto use_count() const noexcept -> std::size_t
+    {
+        return block_ == nullptr
+                   ? 0
+                   : block_->refs.load(std::memory_order_relaxed);
+    }
+
+   private:
+    struct Block {
+        template <typename... Arguments>
+        explicit Block(Arguments&&... args)
+            : values{std::forward<Arguments>(args)...}
+        {}
+
+        std::atomic<std::size_t> refs = 1;
+        Tuple_t const values;
+    };
+
+    using Storage = std::aligned_storage_t<sizeof(Block), alignof(Block)>;
+
+    /// Free list of Block sized storage, shared by all threads.
+    /** Keeps at most max_free blocks, anything beyond goes back to the heap. */
+    class Pool {
+       public:
+        static auto constexpr max_free = std::size_t{256};
+
+       public:
+        auto allocate() noexcept(false) -> void*
+        {
+            {
+                auto const lock = std::lock_guard{mtx_};
+                if (!free_.empty()) {
+                    auto* const storage = free_.back();
+                    free_.pop_back();
+                    return storage;
+                }
+            }
+            return new Storage;
+        }
+
+        void deallocate(void* storage) noexcept
+        {
+            {
+                auto const lock = std::lock_guard{mtx_};
+                if (free_.size() < max_free) {
+                    try {
+                        free_.push_back(static_cast<Storage*>(storage));
+                        return;
+                    }
+                    catch (...) {
+                    }
+                }
+            }
+            delete static_cast<Storage*>(storage);
+        }
+
+       private:
+        std::mutex mtx_;
+        std::vector<Storage*> free_;
+    };
+
+    Block* block_;
+
+   private:
+    explicit Shared_args(Block* block) noexcept : block_{block} {}
+
+    /// Never destroyed, blocks can be released during static destruction.
+    static auto pool() -> Pool&
+    {
+        static auto& instance = *new Pool;
+        return instance;
+    }
+};
+
+template <typename Signature>
+class Queued_slots;
+
+/// A set of Slots delivered through Event_queues, sharing one argument copy.
+/** Connect slot() to a Signal; each emission copies the arguments once into a
+ *  Shared_args and posts one task per target, so the per-target cost does not
+ *  depend on the size of the arguments taken by const reference. A parameter
+ *  taken by value is copied from the shared copy for each target as it is
+ *  delivered. As for Shared_args, Args can't include non-const references. */
+template <typename... Args>
+class Queued_slots<void(Args...)> {
+    static_assert((std::is_convertible_v<std::decay_t<Args> const&, Args> &&
+                   ...),
+                  "Queued_slots: arguments are shared immutable copies, take "
+                  "them by value or by const reference.");
+
+   public:
+    /// Add a target, \p s is invoked on the thread processing \p queue.
+    /** Lifetimes tracked by \p s are checked at delivery. Only affects Slots
+     *  returned by slot() after this call. \p queue must outlive them. */
+    auto add(Event_queue& queue, Slot<void(Args...)> s) noexcept(false)
+        -> Queued_slots&
+    {
+        auto target = std::make_shared<Slot<void(Args...)> const>(std::move(s));
+        targets_.push_back({&queue, std::move(target)});
+        return *this;
+    }
+
+    /// Return the number of targets added.
+    auto size() const noexcept -> std::size_t { return targets_.size(); }
+
+    /// Return a Slot that posts each invocation to every target.
+    auto slot() const noexcept(false) -> Slot<void(Args...)>
+    {
+        auto targets = std::make_shared<std::vector<Target> const>(targets_);
+        return [targets = std::move(targets)](Args... args) {
+            auto const packed =
+                Shared_args<Args...>::make(std::forward<Args>(args)...);
+            for (auto const& [queue, target] : *targets) {
+                queue->post([packed, target = target] {
+                    if (target->is_expired())
+                        return;
+                    packed.apply(target->slot_function());
+                });
+            }
+        };
+    }
+
+   private:
+    struct Target {
+        Event_queue* queue;
+        std::shared_ptr<Slot<void(Args...)> const> slot;
+    };
+
+    std::vector<Target> targets_;
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_SHARED_ARGS_HPP
@@ -0,0 +1,374 @@
+#ifndef SIGNALS_LIGHT_SHM_SIGNAL_HPP
+#define SIGNALS_LIGHT_SHM_SIGNAL_HPP
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <signals_light/detail/futex.hpp>
+#include <signals_light/signal.hpp>
+
+namespace sl::detail {
+
+/// Layout at the start of a Shm_signal segment, followed by the cells.
+struct Shm_header {
+    static auto constexpr magic_value = std::uint64_t{0x736c2d73686d7631};
+
+    std::uint64_t magic;
+    std::uint64_t capacity;
+    std::uint64_t value_size;
+
+    /// Position of the next emission, only written by the producer.
+    alignas(64) std::atomic<std::uint64_t> head;
+
+    /// Futex word, bumped by the producer when receivers are asleep.
+    alignas(64) std::atomic<std::uint32_t> wake_seq;
+    std::atomic<std::uint32_t> sleepers;
+};
+
+/// One emission, \p seq is position + 1 once the value is fully written.
+template <typename T>
+struct Shm_cell {
+    std::atomic<std::uint64_t> seq;
+    T value;
+};
+
+/// Return the byte size of a segment holding \p capacity cells.
+template <typename T>
+auto shm_segment_size(std::size_t capacity) noexcept -> std::size_t
+{
+    auto constexpr align  = alignof(Shm_cell<T>);
+    auto constexpr header = (sizeof(Shm_header) + align - 1) / align * align;
+    return header + capacity * sizeof(Shm_cell<T>);
+}
+
+/// Owning memory mapping of a whole file descriptor.
+class Shm_mapping {
+   public:
+    /// Map \p size bytes of \p fd, shared between processes.
+    /** \p protection is as for mmap. Throws std::system_error if mmap
+     *  fails. */
+    Shm_mapping(int fd,
+                std::size_t size,
+                int protection = PROT_READ | PROT_WRITE) noexcept(false)
+        : data_{::mmap(nullptr, size, protection, MAP_SHARED, fd, 0)},
+          size_{size}
+    {
+        if (data_ == MAP_FAILED)
+            throw std::system_error{errno, std::system_category(),
+                                    "Shm_signal: mmap"};
+    }
+
+    Shm_mapping(Shm_mapping&& x) noexcept
+        : data_{std::exchange(x.data_, MAP_FAILED)}, size_{x.size_}
+    {}
+
+    Shm_mapping(Shm_mapping const&) = delete;
+    auto operator=(Shm_mapping const&) -> Shm_mapping& = delete;
+    auto operator=(Shm_mapping&&) -> Shm_mapping& = delete;
+
+    ~Shm_mapping()
+    {
+        if (data_ != MAP_FAILED)
+            ::munmap(data_, size_);
+    }
+
+   public:
+    auto data() const noexcept -> void* { return data_; }
+
+    auto header() const noexcept -> Shm_header&
+    {
+        return *static_cast<Shm_header*>(data_);
+    }
+
+    template <typename T>
+    auto cell(std::uint64_t position) const noexcept -> Shm_cell<T>&
+    {
+        auto const capacity = header().capacity;
+        auto* const cells   = reinterpret_cast<Shm_cell<T>*>(
+            static_cast<char*>(data_) + shm_segment_size<T>(0));
+        return cells[position % capacity];
+    }
+
+   private:
+    void* data_;
+    std::size_t size_;
+};
+
+/// Throws std::system_error with \p what if \p result is -1.
+inline auto check(int result, char const* what) noexcept(false) -> int
+{
+    if (result == -1)
+        throw std::system_error{errno, std::system_category(), what};
+    return result;
+}
+
+}  // namespace sl::detail
+
+namespace sl {
+
+/// Producer end of a Signal shared between processes. Linux only.
+/** Emissions of trivially copyable \p T are written into a ring buffer in a
+ *  memfd or shm_open segment, where any number of Shm_receiver<T>s, in this
+ *  or other processes, pick them up and re-emit them. The producer never
+ *  waits for receivers, a receiver that falls more than capacity() emissions
+ *  behind loses the oldest ones. An emission only makes a system call if a
+ *  receiver is asleep in Shm_receiver::wait(). Only one thread may emit. */
+template <typename T>
+class Shm_signal {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Shm_signal: T must be trivially copyable.");
+
+   public:
+    /// Create an anonymous memfd segment holding \p capacity emissions.
+    /** Receivers attach with fd(), which is inherited across fork().
+     *  Throws std::invalid_argument if \p capacity is zero, and
+     *  std::system_error if the segment can't be created. */
+    explicit Shm_signal(std::size_t capacity) noexcept(false)
+        : fd_{detail::check(::memfd_create("signals_light", MFD_CLOEXEC),
+                            "Shm_signal: memfd_create")},
+          mapping_{init(name_, fd_, capacity)}
+    {}
+
+    /// Create the named segment \p name, as for shm_open, with \p capacity.
+    /** The name is unlinked when *this is destroyed. Throws
+     *  std::invalid_argument if \p capacity is zero, and std::system_error if
+     *  the segment can't be created, including if it already exists. */
+    Shm_signal(std::string name, std::size_t capacity) noexcept(false)
+        : name_{std::move(name)},
+          fd_{detail::check(::shm_open(name_.c_str(),
+                                       O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC,
+                                       0600),
+                            "Shm_signal: shm_open")},
+          mapping_{init(name_, fd_, capacity)}
+    {}
+
+    Shm_signal(Shm_signal const&) = delete;
+    Shm_signal(Shm_signal&&)      = delete;
+    auto operator=(Shm_signal const&) -> Shm_signal& = delete;
+    auto operator=(Shm_signal&&) -> Shm_signal& = delete;
+
+    /// Attached receivers keep their mapping, they see no more emissions.
+    ~Shm_signal()
+    {
+        if (!name_.empty())
+            ::shm_unlink(name_.c_str());
+        ::close(fd_);
+    }
+
+   public:
+    /// Write \p x into the ring buffer and wake sleeping receivers.
+    void emit(T const& x) noexcept
+    {
+        auto& header   = mapping_.header();
+        auto const pos = header.head.load(std::memory_order_relaxed);
+        auto& cell     = mapping_.template cell<T>(pos);
+
+        // Seqlock, a receiver copying this cell concurrently sees seq change.
+        cell.seq.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        std::memcpy(&cell.value, &x, sizeof(T));
+        cell.seq.store(pos + 1, std::memory_order_release);
+
+        // Pairs with Shm_receiver::wait(), either it sees the new head or
+        // this sees it asleep.
+        header.head.store(pos + 1, std::memory_order_seq_cst);
+        if (header.sleepers.load(std::memory_order_seq_cst) != 0) {
+            header.wake_seq.fetch_add(1, std::memory_order_release);
+            detail::futex_wake_all(header.wake_seq, true);
+        }
+    }
+
+    /// Alternative notation for Shm_signal::emit.
+    void operator()(T const& x) noexcept { this->emit(x); }
+
+    /// Return the file descriptor of the segment, for Shm_receiver.
+    auto fd() const noexcept -> int { return fd_; }
+
+    /// Return the name given at construction, empty for a memfd segment.
+    auto name() const noexcept -> std::string const& { return name_; }
+
+    /// Return the number of emissions the ring buffer holds.
+    auto capacity() const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(mapping_.header().capacity);
+    }
+
+   private:
+    std::string name_;
+    int fd_;
+    detail::Shm_mapping mapping_;
+
+   private:
+    /// Size the segment at \p fd and map it with an initialized header.
+    /** On failure closes \p fd, and unlinks \p name unless it is empty, so
+     *  a later create with the same name doesn't fail with EEXIST. */
+    static auto init(std::string const& name, int fd, std::size_t capacity)
+        noexcept(false) -> detail::Shm_mapping
+    {
+        try {
+            if (capacity == 0)
+                throw std::invalid_argument{"Shm_signal: capacity of zero."};
+            auto const size = detail::shm_segment_size<T>(capacity);
+            detail::check(::ftruncate(fd, static_cast<::off_t>(size)),
+                          "Shm_signal: ftruncate");
+            auto mapping       = detail::Shm_mapping{fd, size};
+            auto* header       = ::new (&mapping.header()) detail::Shm_header{};
+            header->capacity   = capacity;
+            header->value_size = sizeof(T);
+            header->magic      = detail::Shm_header::magic_value;
+            return mapping;
+        }
+        catch (...) {
+            if (!name.empty())
+                ::shm_unlink(name.c_str());
+            ::close(fd);
+            throw;
+        }
+    }
+};
+
+/// Receiving end of a Shm_signal, re-emits each value as a local Signal.
+/** Starts with the next emission after construction. Not thread safe, and
+ *  can't be moved. Linux only. */
+template <typename T>
+class Shm_receiver : public Signal<void(T const&)> {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Shm_receiver: T must be trivially copyable.");
+
+   public:
+    /// Attach to the segment behind \p fd, a Shm_signal<T>::fd().
+    /** \p fd is not owned. Throws std::invalid_argument if the segment was
+     *  not created by a Shm_signal<T>, std::system_error on mapping failure.*/
+    explicit Shm_receiver(int fd) noexcept(false)
+        : mapping_{fd, validated_size(fd)},
+          read_{mapping_.header().head.load(std::memory_order_acquire)}
+    {}
+
+    /// Attach to the segment created by Shm_signal<T>(name, capacity).
+    /** Throws std::invalid_argument if the segment was not created by a
+     *  Shm_signal<T>, std::system_error if it can't be opened or mapped. */
+    explicit Shm_receiver(std::string const& name) noexcept(false)
+        : Shm_receiver{Fd{detail::check(
+              ::shm_open(name.c_str(), O_RDWR | O_CLOEXEC, 0),
+              "Shm_receiver: shm_open")}}
+    {}
+
+    Shm_receiver(Shm_receiver const&) = delete;
+    Shm_receiver(Shm_receiver&&)      = delete;
+    auto operator=(Shm_receiver const&) -> Shm_receiver& = delete;
+    auto operator=(Shm_receiver&&) -> Shm_receiver& = delete;
+
+   public:
+    /// Emit every value written since the last call, without blocking.
+    /** Makes no system calls. Returns the number of values emitted. */
+    auto poll() noexcept(false) -> std::size_t
+    {
+        auto& header        = mapping_.header();
+        auto const capacity = header.capacity;
+        auto emitted        = std::size_t{0};
+        while (true) {
+            auto const head = header.head.load(std::memory_order_acquire);
+            if (read_ == head)
+                return emitted;
+            if (head - read_ > capacity) {
+                overruns_ += head - read_ - capacity;
+                read_ = head - capacity;
+            }
+            auto& cell     = mapping_.template cell<T>(read_);
+            auto const seq = cell.seq.load(std::memory_order_acquire);
+            auto value     = T{};
+            std::memcpy(&value, &cell.value, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            auto const overwritten =
+                seq != read_ + 1 ||
+                cell.seq.load(std::memory_order_relaxed) != seq;
+            ++read_;
+            if (overwritten) {
+                ++overruns_;
+                continue;
+            }
+            this->emit(value);
+            ++emitted;
+        }
+    }
+
+    /// Emit pending values, sleeping up to \p timeout if there are none.
+    /** Returns the number of values emitted, zero on timeout. */
+    template <typename Rep, typename Period>
+    auto wait(std::chrono::duration<Rep, Period> timeout) noexcept(false)
+        -> std::size_t
+    {
+        using Clock = std::chrono::steady_clock;
+        auto const deadline =
+            Clock::now() + std::chrono::duration_cast<Clock::duration>(timeout);
+        auto& header = mapping_.header();
+        while (true) {
+            if (auto const n = this->poll(); n != 0)
+                return n;
+            auto const wake = header.wake_seq.load(std::memory_order_acquire);
+            header.sleepers.fetch_add(1, std::memory_order_seq_cst);
+            auto timed_out = false;
+            if (header.head.load(std::memory_order_seq_cst) == read_) {
+                timed_out = !detail::futex_wait(header.wake_seq, wake,
+                                                deadline - Clock::now(), true);
+            }
+            header.sleepers.fetch_sub(1, std::memory_order_seq_cst);
+            if (timed_out)
+                return this->poll();
+        }
+    }
+
+    /// Return the number of values lost by falling too far behind.
+    auto overruns() const noexcept -> std::uint64_t { return overruns_; }
+
+   private:
+    /// Closes a file descriptor owned only during construction.
+    struct Fd {
+        int value;
+        ~Fd() { ::close(value); }
+    };
+
+    detail::Shm_mapping mapping_;
+    std::uint64_t read_;
+    std::uint64_t overruns_ = 0;
+
+   private:
+    explicit Shm_receiver(Fd const& fd) noexcept(false) : Shm_receiver{fd.value}
+    {}
+
+    /// Return the segment size, after checking it holds a Shm_signal<T>.
+    static auto validated_size(int fd) noexcept(false) -> std::size_t
+    {
+        auto constexpr message = "Shm_receiver: not a matching Shm_signal.";
+        struct ::stat st       = {};
+        detail::check(::fstat(fd, &st), "Shm_receiver: fstat");
+        auto const size = static_cast<std::size_t>(st.st_size);
+        if (size < sizeof(detail::Shm_header))
+            throw std::invalid_argument{message};
+        auto const probe = detail::Shm_mapping{fd, sizeof(detail::Shm_header)};
+        auto const& header = probe.header();
+        if (header.magic != detail::Shm_header::magic_value ||
+            header.value_size != sizeof(T) ||
+            detail::shm_segment_size<T>(header.capacity) != size) {
+            throw std::invalid_argument{message};
+        }
+        return size;
+    }
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_SHM_SIGNAL_HPP
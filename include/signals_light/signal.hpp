@@ -1,15 +1,166 @@
 #ifndef SIGNALS_LIGHT_SIGNAL_HPP
 #define SIGNALS_LIGHT_SIGNAL_HPP
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 
+#include <signals_light/detail/relocating_vector.hpp>
+#include <signals_light/scratch.hpp>
+#include <signals_light/slot_storage.hpp>
+
+namespace sl::detail {
+
+/// Process wide counters of Lifetime control blocks.
+struct Lifetime_counters {
+    std::atomic<std::size_t> live   = 0;  // Blocks whose Lifetime exists.
+    std::atomic<std::size_t> blocks = 0;  // Allocated, live or expired.
+    std::atomic<std::size_t> bytes  = 0;
+};
+
+inline auto lifetime_counters() noexcept -> Lifetime_counters&
+{
+    static auto counters = Lifetime_counters{};
+    return counters;
+}
+
+/// The object owned by a Lifetime's std::shared_ptr, counts itself as live.
+struct Lifetime_token {
+    Lifetime_token() noexcept
+    {
+        lifetime_counters().live.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    ~Lifetime_token()
+    {
+        lifetime_counters().live.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    Lifetime_token(Lifetime_token const&) = delete;
+    auto operator=(Lifetime_token const&) -> Lifetime_token& = delete;
+};
+
+/// std::allocator that counts the control blocks of Lifetimes.
+template <typename T>
+struct Lifetime_allocator {
+    using value_type = T;
+
+    Lifetime_allocator() = default;
+
+    template <typename U>
+    Lifetime_allocator(Lifetime_allocator<U> const&) noexcept
+    {}
+
+    auto allocate(std::size_t n) noexcept(false) -> T*
+    {
+        auto* const p   = std::allocator<T>{}.allocate(n);
+        auto& counters  = lifetime_counters();
+        counters.blocks.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes.fetch_add(n * sizeof(T), std::memory_order_relaxed);
+        return p;
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        std::allocator<T>{}.deallocate(p, n);
+        auto& counters = lifetime_counters();
+        counters.blocks.fetch_sub(1, std::memory_order_relaxed);
+        counters.bytes.fetch_sub(n * sizeof(T), std::memory_order_relaxed);
+    }
+
+    template <typename U>
+    friend auto operator==(Lifetime_allocator,
+                           Lifetime_allocator<U>) noexcept -> bool
+    {
+        return true;
+    }
+
+    template <typename U>
+    friend auto operator!=(Lifetime_allocator,
+                           Lifetime_allocator<U>) noexcept -> bool
+    {
+        return false;
+    }
+};
+
+/// Heap bytes used by the std::function targets of one type.
+struct Function_target_size {
+    std::type_info const* type;
+    std::size_t heap_bytes;
+    Function_target_size const* next;
+};
+
+/// Heap bytes used by std::function targets, by target type.
+/** Filled in the first time a Slot is constructed from each type, as a list
+ *  of static nodes pushed with a compare and swap, so recording a new type
+ *  neither locks nor allocates. A Slot of a type still being recorded by
+ *  another thread counts zero. Never destroyed, Slots can be inspected during
+ *  static destruction. */
+class Function_target_sizes {
+   public:
+    /// Publish \p node, which must have static storage duration.
+    static void record(Function_target_size& node) noexcept
+    {
+        auto& head = Function_target_sizes::head();
+        node.next  = head.load(std::memory_order_relaxed);
+        while (!head.compare_exchange_weak(node.next, &node,
+                                           std::memory_order_release,
+                                           std::memory_order_relaxed)) {}
+    }
+
+    /// Return the recorded heap bytes of \p type, zero if unknown.
+    /** Linear in the number of target types recorded. */
+    static auto find(std::type_info const& type) noexcept -> std::size_t
+    {
+        auto const* node = head().load(std::memory_order_acquire);
+        for (; node != nullptr; node = node->next) {
+            if (*node->type == type)
+                return node->heap_bytes;
+        }
+        return 0;
+    }
+
+   private:
+    static auto head() noexcept -> std::atomic<Function_target_size const*>&
+    {
+        static auto instance = std::atomic<Function_target_size const*>{};
+        return instance;
+    }
+};
+
+/// Record whether \p f stores its target of type F inline or on the heap.
+/** Only the first call for each F records anything. */
+template <typename F, typename Function>
+void record_target_size(Function const& f) noexcept
+{
+    static auto node    = Function_target_size{};
+    static auto claimed = std::atomic<bool>{false};
+    if (claimed.load(std::memory_order_relaxed) ||
+        claimed.exchange(true, std::memory_order_relaxed)) {
+        return;
+    }
+    auto const* target = reinterpret_cast<char const*>(f.template target<F>());
+    auto const* begin  = reinterpret_cast<char const*>(&f);
+    auto const inlined = target == nullptr ||
+                         (!std::less<>{}(target, begin) &&
+                          std::less<>{}(target, begin + sizeof(f)));
+    node.type       = &typeid(F);
+    node.heap_bytes = inlined ? 0 : sizeof(F);
+    Function_target_sizes::record(node);
+}
+
+}  // namespace sl::detail
+
 namespace sl {
 
 /// Provides a const view of a std::weak_ptr, providing an is_expired() check.
@@ -72,18 +223,29 @@ class Lifetime_observer {
     }
 };
 
+}  // namespace sl
+
+namespace sl::detail {
+
+/// A Lifetime_observer is a std::weak_ptr.
+template <>
+struct is_trivially_relocatable<Lifetime_observer>
+    : std::bool_constant<std_library_is_relocatable> {};
+
+}  // namespace sl::detail
+
+namespace sl {
+
 /// A class to keep track of an object's lifetime.
 /** A Lifetime_observer can check if a Lifetime has ended. */
 class Lifetime {
    public:
     /// Create a new lifetime to track.
-    Lifetime() noexcept(false) : life_{std::make_shared<bool>(true)} {}
+    Lifetime() noexcept(false) : life_{make_life()} {}
 
     /// Create a new lifetime to track.
     /** Tracking does not split across multiple Lifetime objects. */
-    Lifetime(Lifetime const&) noexcept(false)
-        : life_{std::make_shared<bool>(true)}
-    {}
+    Lifetime(Lifetime const&) noexcept(false) : life_{make_life()} {}
 
     /// Transfers the lifetime tracking to the new instance.
     /** Existing trackers will now track the newly constructed lifetime. */
@@ -95,7 +257,7 @@ class Lifetime {
     {
         if (this == &rhs)
             return *this;
-        life_ = std::make_shared<bool>(true);
+        life_ = make_life();
         return *this;
     }
 
@@ -116,8 +278,34 @@ class Lifetime {
      *  construction, it might not throw std::bad_alloc, returning nullptr. */
     auto track() const noexcept(false) -> Lifetime_observer { return life_; }
 
+    /// Process wide counts of Lifetime control blocks.
+    struct Stats {
+        std::size_t live;            // Blocks whose Lifetime still exists.
+        std::size_t control_blocks;  // Live plus expired but still observed.
+        std::size_t bytes;           // Heap bytes of all control_blocks.
+    };
+
+    /// Return the current Stats, thread safe.
+    /** control_blocks - live is the number of expired Lifetimes kept alive by
+     *  Lifetime_observers, such as those of expired but connected Slots. */
+    static auto global_stats() noexcept -> Stats
+    {
+        auto const& counters = detail::lifetime_counters();
+        return {counters.live.load(std::memory_order_relaxed),
+                counters.blocks.load(std::memory_order_relaxed),
+                counters.bytes.load(std::memory_order_relaxed)};
+    }
+
    private:
-    std::shared_ptr<bool> life_;
+    std::shared_ptr<detail::Lifetime_token> life_;
+
+   private:
+    static auto make_life() noexcept(false)
+        -> std::shared_ptr<detail::Lifetime_token>
+    {
+        return std::allocate_shared<detail::Lifetime_token>(
+            detail::Lifetime_allocator<detail::Lifetime_token>{});
+    }
 };
 
 template <typename Signature>
@@ -147,6 +335,7 @@ class Slot<R(Args...)> {
     {
         static_assert(std::is_invocable_r_v<R, F, Args...>,
                       "Slot initialization with invalid function type.");
+        detail::record_target_size<F>(f_);
     }
 
     /// Construct a Slot with the slot function \p f and no tracked objects.
@@ -226,13 +415,28 @@ class Slot<R(Args...)> {
             [](Lifetime_observer const& x) { return x.is_expired(); });
     }
 
+    /// Return true if any Lifetime is tracked by *this.
+    auto is_tracked() const noexcept -> bool { return !observers_.empty(); }
+
     /// Return a const reference to the internal std::function.
     /** Always returns a valid Function_t object that can be called. */
     auto slot_function() const noexcept -> Function_t const& { return f_; }
 
+    /// Return the bytes used by *this, including sizeof(Slot).
+    /** Counts the tracked list capacity and the heap storage of the slot
+     *  function. The latter is only known for target types that have been
+     *  passed to a Slot constructor directly, and counts zero otherwise.
+     *  Lifetime control blocks are shared, see Lifetime::global_stats(). */
+    auto memory_usage() const noexcept(false) -> std::size_t
+    {
+        return sizeof(Slot) +
+               observers_.capacity() * sizeof(Lifetime_observer) +
+               detail::Function_target_sizes::find(f_.target_type());
+    }
+
    private:
     Function_t f_;
-    std::vector<Lifetime_observer> observers_;
+    detail::Slot_vector_t<Lifetime_observer> observers_;
 
    private:
     /// Throws std::invalid_argument if f == nullptr, returns \p f otherwise.
@@ -243,6 +447,19 @@ class Slot<R(Args...)> {
     }
 };
 
+}  // namespace sl
+
+namespace sl::detail {
+
+/// A Slot is a std::function and a Relocating_vector of observers.
+template <typename R, typename... Args>
+struct is_trivially_relocatable<Slot<R(Args...)>>
+    : std::bool_constant<std_library_is_relocatable> {};
+
+}  // namespace sl::detail
+
+namespace sl {
+
 /// Objects of this type can be unique and compared against other identifiers.
 class Identifier {
    public:
@@ -271,6 +488,12 @@ class Identifier {
         return !(x == y);
     }
 
+    /// Return true if \p x was generated before \p y by next(...).
+    friend auto operator<(Identifier x, Identifier y) noexcept -> bool
+    {
+        return x.value_ < y.value_;
+    }
+
    private:
     /// Used by next(...).
     Identifier(Underlying_int value) noexcept : value_{value} {}
@@ -279,12 +502,59 @@ class Identifier {
     Underlying_int value_;
 };
 
-template <typename Signature>
+/// True if an argument of type T is copied rather than referenced on emit.
+/** Defaults to scalar types, which are passed in registers. Class types are
+ *  referenced unless opted in by specializing this to std::true_type, for a
+ *  small trivially copyable struct. The default never looks at the size of a
+ *  class, so a Signal member can take its own, still incomplete, class. */
+template <typename T>
+struct is_passed_by_value : std::is_scalar<T> {};
+
+}  // namespace sl
+
+namespace sl::detail {
+
+/// True if a Signature argument declared as Arg can be passed as a copy.
+/** By value and const reference arguments only, a non-const reference must
+ *  bind to the caller's object. */
+template <typename Arg>
+auto constexpr pass_by_value = std::conjunction_v<
+    std::negation<std::is_rvalue_reference<Arg>>,
+    std::disjunction<std::negation<std::is_reference<Arg>>,
+                     std::is_const<std::remove_reference_t<Arg>>>,
+    is_passed_by_value<std::remove_cv_t<std::remove_reference_t<Arg>>>>;
+
+/// Arg, or a copy if pass_by_value, for a call that consumes the argument.
+template <typename Arg>
+using Call_param_t =
+    std::conditional_t<pass_by_value<Arg>,
+                       std::remove_cv_t<std::remove_reference_t<Arg>>,
+                       Arg>;
+
+}  // namespace sl::detail
+
+namespace sl {
+
+/// The parameter type emit uses for a Signature argument declared as Arg.
+/** A copy if detail::pass_by_value<Arg>, Arg const& otherwise, so an int or
+ *  an opted in small struct reaches each Slot in registers instead of through
+ *  memory, while other arguments are still shared by every Slot. */
+template <typename Arg>
+using Param_t = std::conditional_t<detail::pass_by_value<Arg>,
+                                   detail::Call_param_t<Arg>,
+                                   Arg const&>;
+
+template <typename Signature, typename Storage = Vector_storage>
 class Signal;
 
+template <typename Signature, typename Storage = Vector_storage>
+class Emit_cursor;
+
 /// An observer type that calls registered callbacks(Slots) when emitted.
-template <typename R, typename... Args>
-class Signal<R(Args...)> {
+/** Storage is the policy that holds the connected Slots, see
+ *  slot_storage.hpp for the requirements and the built-in policies. */
+template <typename R, typename... Args, typename Storage>
+class Signal<R(Args...), Storage> {
    public:
     using Signature_t = R(Args...);
     using Emit_result_t =
@@ -325,73 +595,258 @@ class Signal<R(Args...)> {
     /// Invoke all non-expired Slots.
     /** Returns the return value of the last connected Slot or std::nullopt if
      *  none. Expired Slots are ignored, rather than throwing an exception. */
-    auto emit(Args const&... args) const -> Emit_result_t
+    auto emit(Param_t<Args>... args) const -> Emit_result_t
+    {
+        return this->emit_with(
+            [](Identifier, auto const& slot_fn, Param_t<Args>... args) -> R {
+                return slot_fn(args...);
+            },
+            args...);
+    }
+
+    /// Alternative notation for Signal::emit.
+    auto operator()(Param_t<Args>... args) const -> Emit_result_t
+    {
+        return this->emit(args...);
+    }
+
+    /// Return a cursor that emits to the Slots a slice at a time.
+    /** Nothing is invoked until the cursor is advanced. The arguments are
+     *  copied into the cursor, except non-const lvalue references, which are
+     *  kept so Slots modify the caller's object as with emit(). *this, and
+     *  any object passed by non-const reference, must outlive the cursor. */
+    auto emit_incremental(Param_t<Args>... args) const noexcept(false)
+        -> Emit_cursor<R(Args...), Storage>
+    {
+        return Emit_cursor<R(Args...), Storage>{*this, args...};
+    }
+
+    /// Register a Slot with *this, will be invoked when *this is emitted.
+    /** Returns a unique Identifier, to be used with Signal::disconnect. An
+     *  Identifier is not reused after its Slot is disconnected. */
+    auto connect(Slot<Signature_t> s) noexcept(false) -> Identifier
+    {
+        auto const id = next_id_;
+        slots_.push_back({id, std::move(s)});
+        next_id_ = Identifier::next(id);
+        return id;
+    }
+
+    /// Removes and returns the Slot associated with the given Identifier.
+    /** Throws std::invalid_argument if no connected Slot is found with id. */
+    auto disconnect(Identifier id) noexcept(false) -> Slot<Signature_t>
+    {
+        auto const iter = slots_.find(id);
+        if (iter == std::end(slots_))
+            throw std::invalid_argument{"Signal::disconnect: No matching id."};
+        auto slot = std::move(iter->second);
+        slots_.erase(iter);
+        return std::move(slot);
+    }
+
+    /// Disconnect every Slot that has expired.
+    /** Returns the number of Slots disconnected. The order of the remaining
+     *  Slots is kept. */
+    auto purge_expired() noexcept -> std::size_t
+    {
+        return slots_.remove_if(
+            [](auto const& id_slot) { return id_slot.second.is_expired(); });
+    }
+
+    /// Disconnect every Slot.
+    void disconnect_all() noexcept { slots_.clear(); }
+
+    /// Return the number of connected Slots.
+    auto slot_count() const noexcept -> std::size_t { return slots_.size(); }
+
+    /// Return true if there are no connected Slots.
+    auto is_empty() const noexcept -> bool { return slots_.empty(); }
+
+    /// Return the number of connected Slots that have expired.
+    /** Expired Slots stay connected, and are skipped by emit, until they are
+     *  disconnected. */
+    auto expired_slot_count() const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(std::count_if(
+            std::cbegin(slots_), std::cend(slots_),
+            [](auto const& id_slot) { return id_slot.second.is_expired(); }));
+    }
+
+    /// Return the bytes used by *this, including sizeof(Signal).
+    /** Counts the heap memory of the Slot container and Slot::memory_usage()
+     *  of each connected Slot, expired or not. */
+    auto memory_usage() const noexcept(false) -> std::size_t
     {
+        auto total = sizeof(Signal) + slots_.heap_bytes();
+        for (auto const& id_slot : slots_)
+            total += id_slot.second.memory_usage() - sizeof(id_slot.second);
+        return total;
+    }
+
+   protected:
+    /// Invoke all non-expired Slots through \p invoke.
+    /** \p invoke is called as invoke(id, slot_function, args...) for each
+     *  Slot and must return its result, this lets derived Signals wrap each
+     *  Slot invocation. Otherwise the same as emit(). */
+    template <typename Invoke>
+    auto emit_with(Invoke&& invoke, Param_t<Args>... args) const
+        -> Emit_result_t
+    {
+        auto const scope = detail::Emission_scope{};
         if constexpr (std::is_same_v<void, R>) {
             for (auto const& [id, slot] : slots_) {
                 if (slot.is_expired())
                     continue;
-                slot.slot_function()(args...);
+                invoke(id, slot.slot_function(), args...);
             }
         }
         else {
             // Only return the last non-expired slot result.
+            auto const rend = std::make_reverse_iterator(std::cbegin(slots_));
             auto const last_valid_iter =
-                std::find_if(std::crbegin(slots_), std::crend(slots_),
-                             [](auto const& id_slot) {
+                std::find_if(std::make_reverse_iterator(std::cend(slots_)),
+                             rend, [](auto const& id_slot) {
                                  return !id_slot.second.is_expired();
                              });
-            if (last_valid_iter == std::crend(slots_))
+            if (last_valid_iter == rend)
                 return std::nullopt;
             for (auto const& [id, slot] : slots_) {
                 if (slot.is_expired())
                     continue;
                 if (&slot == &(last_valid_iter->second))
-                    return slot.slot_function()(args...);
-                slot.slot_function()(args...);
+                    return invoke(id, slot.slot_function(), args...);
+                invoke(id, slot.slot_function(), args...);
             }
             return std::nullopt;
         }
     }
 
-    /// Alternative notation for Signal::emit.
-    auto operator()(Args const&... args) const -> Emit_result_t
+    /// Return true if the Slot associated with \p id is still connected.
+    /** Lets derived Signals drop their own state for Slots removed by
+     *  purge_expired or through a reference to this base class. */
+    auto is_connected(Identifier id) noexcept -> bool
     {
-        return this->emit(args...);
+        return slots_.find(id) != std::end(slots_);
     }
 
-    /// Register a Slot with *this, will be invoked when *this is emitted.
-    /** Returns a unique Identifier, to be used with Signal::disconnect. */
-    auto connect(Slot<Signature_t> s) noexcept(false) -> Identifier
+   private:
+    friend class Emit_cursor<R(Args...), Storage>;
+
+    using Element_t = std::pair<Identifier, Slot<R(Args...)>>;
+
+    typename Storage::template Container_t<Element_t> slots_;
+    Identifier next_id_;  // Never reused, so an old id can't match a new Slot.
+};
+
+/// A Signal emission that runs in slices, returned by emit_incremental.
+/** Each advance invokes Slots in connection order until its budget is spent,
+ *  and the next one resumes after the last Slot visited, found by Identifier.
+ *  Between slices Slots can be connected, disconnected or expire: Slots
+ *  disconnected or expired before they are reached are not invoked, Slots
+ *  connected after the cursor was created are. Within a slice, Slots must not
+ *  connect to or disconnect from the Signal. */
+template <typename R, typename... Args, typename Storage>
+class Emit_cursor<R(Args...), Storage> {
+   public:
+    using Emit_result_t = typename Signal<R(Args...), Storage>::Emit_result_t;
+
+   public:
+    /// Invoke at most \p slot_budget Slots, expired Slots are not counted.
+    /** Returns true once every Slot has been visited. */
+    auto advance(std::size_t slot_budget) noexcept(false) -> bool
     {
-        auto const id = slots_.empty() ? Identifier{}
-                                       : Identifier::next(slots_.back().first);
-        slots_.push_back({id, std::move(s)});
-        return id;
+        auto invoked = std::size_t{0};
+        return this->run([&] { return invoked++ == slot_budget; });
     }
 
-    /// Removes and returns the Slot associated with the given Identifier.
-    /** Throws std::invalid_argument if no connected Slot is found with id. */
-    auto disconnect(Identifier id) noexcept(false) -> Slot<Signature_t>
+    /// Invoke Slots until \p budget has elapsed, checked every few Slots.
+    /** Returns true once every Slot has been visited. */
+    template <typename Rep, typename Period>
+    auto advance_for(std::chrono::duration<Rep, Period> budget) noexcept(false)
+        -> bool
     {
-        auto const iter = std::find_if(
-            std::cbegin(slots_), std::cend(slots_),
-            [id](auto const& id_slot) { return id_slot.first == id; });
-        if (iter == std::cend(slots_))
-            throw std::invalid_argument{"Signal::disconnect: No matching id."};
-        auto slot = std::move(iter->second);
-        slots_.erase(iter);
-        return std::move(slot);
+        using Clock           = std::chrono::steady_clock;
+        auto constexpr stride = 8u;
+        auto const deadline =
+            Clock::now() + std::chrono::duration_cast<Clock::duration>(budget);
+        auto invoked = 0u;
+        return this->run([&] {
+            return ++invoked % stride == 0 && Clock::now() >= deadline;
+        });
     }
 
-    /// Return the number of connected Slots.
-    auto slot_count() const noexcept -> std::size_t { return slots_.size(); }
+    /// Return true once every Slot has been visited.
+    auto is_done() const noexcept -> bool { return done_; }
 
-    /// Return true if there are no connected Slots.
-    auto is_empty() const noexcept -> bool { return slots_.empty(); }
+    /// Return the result of the last Slot invoked so far.
+    /** std::nullopt if none has been. Returns nothing for void Signals. */
+    auto result() const -> Emit_result_t
+    {
+        if constexpr (!std::is_same_v<void, R>)
+            return result_;
+    }
 
    private:
-    std::vector<std::pair<Identifier, Slot<R(Args...)>>> slots_;
+    friend class Signal<R(Args...), Storage>;
+
+    using Result_storage_t =
+        std::conditional_t<std::is_same_v<void, R>, bool, std::optional<R>>;
+
+    /// A non-const lvalue reference can't bind a temporary, so it is kept.
+    template <typename T>
+    using Stored_t = std::conditional_t<
+        std::is_lvalue_reference_v<T> &&
+            !std::is_const_v<std::remove_reference_t<T>>,
+        T,
+        std::decay_t<T>>;
+
+    Signal<R(Args...), Storage> const* signal_;
+    std::tuple<Stored_t<Args>...> args_;
+    std::optional<Identifier> last_;  // Last Slot visited.
+    bool done_ = false;
+    Result_storage_t result_{};
+
+   private:
+    Emit_cursor(Signal<R(Args...), Storage> const& signal,
+                Param_t<Args>... args)
+        : signal_{&signal}, args_{args...}
+    {}
+
+    /// Visit Slots after last_ until \p should_stop returns true.
+    /** should_stop is called before each non-expired Slot. */
+    template <typename Should_stop>
+    auto run(Should_stop&& should_stop) noexcept(false) -> bool
+    {
+        if (done_)
+            return true;
+        auto const scope  = detail::Emission_scope{};
+        auto const& slots = signal_->slots_;
+        auto iter         = std::cbegin(slots);
+        if (last_.has_value()) {
+            iter = std::upper_bound(
+                std::cbegin(slots), std::cend(slots), *last_,
+                [](Identifier id, auto const& id_slot) {
+                    return id < id_slot.first;
+                });
+        }
+        for (; iter != std::cend(slots); ++iter) {
+            auto const& [id, slot] = *iter;
+            if (slot.is_expired()) {
+                last_ = id;
+                continue;
+            }
+            if (should_stop())
+                return false;
+            last_ = id;
+            auto const& f = slot.slot_function();
+            if constexpr (std::is_same_v<void, R>)
+                std::apply(f, args_);
+            else
+                result_ = std::apply(f, args_);
+        }
+        done_ = true;
+        return true;
+    }
 };
 
 }  // namespace sl
@@ -0,0 +1,113 @@
+#ifndef SIGNALS_LIGHT_SIGNAL_BASE_HPP
+#define SIGNALS_LIGHT_SIGNAL_BASE_HPP
+#include <cstddef>
+#include <utility>
+
+#include <signals_light/signal.hpp>
+
+namespace sl::detail {
+
+/// Matches a Signal or a class derived from one, never called.
+template <typename R, typename... Args, typename Storage>
+auto as_signal(Signal<R(Args...), Storage>& signal)
+    -> Signal<R(Args...), Storage>&;
+
+}  // namespace sl::detail
+
+namespace sl {
+
+/// A reference to a Signal of any signature, for bulk maintenance.
+/** Two pointers: the Signal and a static table of functions for its type,
+ *  so Signal itself gains no vtable pointer. Does not own the Signal, which
+ *  must outlive every use. The table is built for the type passed to the
+ *  constructor, so a Signal derived class that keeps its own per Slot state
+ *  must be passed as itself, its purge_expired and disconnect_all hide the
+ *  base class versions to keep that state in sync. */
+class Signal_base {
+   public:
+    /// Slot counts and memory of a Signal.
+    struct Stats {
+        std::size_t slots;
+        std::size_t expired_slots;
+        std::size_t bytes;  // Signal::memory_usage().
+    };
+
+   public:
+    /// Refer to \p signal, a Signal or a class derived from one.
+    template <typename Signal_t,
+              typename = decltype(detail::as_signal(std::declval<Signal_t&>()))>
+    Signal_base(Signal_t& signal) noexcept
+        : signal_{&signal}, table_{&table_for<Signal_t>}
+    {}
+
+   public:
+    /// Return the number of connected Slots.
+    auto slot_count() const noexcept -> std::size_t
+    {
+        return table_->slot_count(signal_);
+    }
+
+    /// Return true if there are no connected Slots.
+    auto is_empty() const noexcept -> bool { return this->slot_count() == 0; }
+
+    /// Disconnect every expired Slot, returns the number disconnected.
+    auto purge_expired() const noexcept -> std::size_t
+    {
+        return table_->purge_expired(signal_);
+    }
+
+    /// Disconnect every Slot.
+    void disconnect_all() const noexcept { table_->disconnect_all(signal_); }
+
+    /// Return the Slot counts and memory usage of the Signal.
+    auto stats() const noexcept(false) -> Stats
+    {
+        return table_->stats(signal_);
+    }
+
+    /// Return true if both refer to the same Signal.
+    friend auto operator==(Signal_base x, Signal_base y) noexcept -> bool
+    {
+        return x.signal_ == y.signal_;
+    }
+
+    friend auto operator!=(Signal_base x, Signal_base y) noexcept -> bool
+    {
+        return !(x == y);
+    }
+
+   private:
+    struct Table {
+        std::size_t (*slot_count)(void const*) noexcept;
+        std::size_t (*purge_expired)(void*) noexcept;
+        void (*disconnect_all)(void*) noexcept;
+        Stats (*stats)(void const*);
+    };
+
+    template <typename Signal_t>
+    static Table const table_for;
+
+    void* signal_;
+    Table const* table_;
+};
+
+template <typename Signal_t>
+inline Signal_base::Table const Signal_base::table_for = {
+    [](void const* s) noexcept {
+        return static_cast<Signal_t const*>(s)->slot_count();
+    },
+    [](void* s) noexcept {
+        return static_cast<Signal_t*>(s)->purge_expired();
+    },
+    [](void* s) noexcept {
+        static_cast<Signal_t*>(s)->disconnect_all();
+    },
+    [](void const* s) {
+        auto const& signal = *static_cast<Signal_t const*>(s);
+        return Stats{signal.slot_count(), signal.expired_slot_count(),
+                     signal.memory_usage()};
+    },
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_SIGNAL_BASE_HPP
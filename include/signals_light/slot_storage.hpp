@@ -0,0 +1,587 @@
+#ifndef SIGNALS_LIGHT_SLOT_STORAGE_HPP
+#define SIGNALS_LIGHT_SLOT_STORAGE_HPP
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <signals_light/detail/relocating_vector.hpp>
+
+// A Signal's Storage policy provides a class template Container_t<Element>,
+// Element being std::pair<Identifier, Slot<R(Args...)>>, with:
+//
+//   Regular construction, copy, move and assignment; moved from is empty.
+//   begin(), end()  Bidirectional iterators over the connected Elements, in
+//                   increasing Identifier order, const and non-const.
+//   size(), empty()
+//   back()          The Element with the greatest Identifier, if not empty.
+//   push_back(e)    Append an Element with a greater Identifier than all
+//                   others. Strong exception guarantee.
+//   find(id)        Iterator to the Element with Identifier id, or end().
+//   erase(iter)     Remove the Element, invalidates iterators.
+//   remove_if(p)    Remove the Elements p returns true for, keeping the order
+//                   of the rest. Returns the number removed.
+//   clear()
+//   heap_bytes()    Bytes allocated outside of the container object.
+
+namespace sl::detail {
+
+/// A vector with room for N elements inside the object.
+/** If Grows, elements move to the heap once there are more than N, otherwise
+ *  push_back throws std::length_error and nothing is ever allocated. */
+template <typename T, std::size_t N, bool Grows>
+class Inline_vector {
+    static_assert(N > 0, "Inline_vector: N must not be zero.");
+    static_assert(std::is_nothrow_move_constructible_v<T>,
+                  "Inline_vector: T must be nothrow move constructible.");
+
+   public:
+    using value_type     = T;
+    using size_type      = std::size_t;
+    using iterator       = T*;
+    using const_iterator = T const*;
+
+   public:
+    Inline_vector() noexcept : data_{this->inline_data()} {}
+
+    Inline_vector(Inline_vector const& x) noexcept(false) : Inline_vector{}
+    {
+        if (x.size_ > N)
+            this->grow(x.size_);
+        for (auto const& element : x)
+            this->push_back(element);
+    }
+
+    Inline_vector(Inline_vector&& x) noexcept : Inline_vector{}
+    {
+        this->take(x);
+    }
+
+    auto operator=(Inline_vector const& x) noexcept(false) -> Inline_vector&
+    {
+        if (this == &x)
+            return *this;
+        auto copy = x;
+        this->release();
+        this->take(copy);
+        return *this;
+    }
+
+    auto operator=(Inline_vector&& x) noexcept -> Inline_vector&
+    {
+        if (this != &x) {
+            this->release();
+            this->take(x);
+        }
+        return *this;
+    }
+
+    ~Inline_vector() { this->release(); }
+
+   public:
+    void push_back(T const& x) noexcept(false) { this->emplace_back(x); }
+
+    void push_back(T&& x) noexcept(false) { this->emplace_back(std::move(x)); }
+
+    /// Construct an element at the end, moving to the heap if full.
+    /** Throws std::length_error if full and not Grows. */
+    template <typename... Arguments>
+    auto emplace_back(Arguments&&... args) noexcept(false) -> T&
+    {
+        if (size_ == capacity_) {
+            if constexpr (!Grows)
+                throw std::length_error{"Inline_vector: Capacity exceeded."};
+            else
+                return this->grow_and_emplace(std::forward<Arguments>(args)...);
+        }
+        ::new (static_cast<void*>(data_ + size_))
+            T(std::forward<Arguments>(args)...);
+        return data_[size_++];
+    }
+
+    auto erase(const_iterator pos) noexcept -> iterator
+    {
+        return this->erase(pos, pos + 1);
+    }
+
+    auto erase(const_iterator first, const_iterator last) noexcept -> iterator
+    {
+        auto* const p = data_ + (first - data_);
+        auto* const q = data_ + (last - data_);
+        if (p == q)
+            return p;
+        auto* const end = data_ + size_;
+        if constexpr (is_trivially_relocatable_v<T>) {
+            std::destroy(p, q);
+            std::memmove(static_cast<void*>(p), q, (end - q) * sizeof(T));
+        }
+        else {
+            std::destroy(std::move(q, end, p), end);
+        }
+        size_ -= static_cast<size_type>(q - p);
+        return p;
+    }
+
+    void clear() noexcept
+    {
+        std::destroy(data_, data_ + size_);
+        size_ = 0;
+    }
+
+   public:
+    auto size() const noexcept -> size_type { return size_; }
+
+    auto capacity() const noexcept -> size_type { return capacity_; }
+
+    auto empty() const noexcept -> bool { return size_ == 0; }
+
+    /// Return the bytes of the heap buffer, zero while inline.
+    auto heap_bytes() const noexcept -> std::size_t
+    {
+        return this->is_inline() ? 0 : capacity_ * sizeof(T);
+    }
+
+    auto back() noexcept -> T& { return data_[size_ - 1]; }
+    auto back() const noexcept -> T const& { return data_[size_ - 1]; }
+
+    auto begin() noexcept -> iterator { return data_; }
+    auto begin() const noexcept -> const_iterator { return data_; }
+
+    auto end() noexcept -> iterator { return data_ + size_; }
+    auto end() const noexcept -> const_iterator { return data_ + size_; }
+
+   private:
+    T* data_;
+    size_type size_     = 0;
+    size_type capacity_ = N;
+    alignas(T) unsigned char buffer_[N * sizeof(T)];
+
+   private:
+    auto inline_data() noexcept -> T*
+    {
+        return reinterpret_cast<T*>(buffer_);
+    }
+
+    auto is_inline() const noexcept -> bool
+    {
+        return data_ == reinterpret_cast<T const*>(buffer_);
+    }
+
+    /// Move the \p count elements at \p from to uninitialized \p to.
+    static void relocate(T* from, size_type count, T* to) noexcept
+    {
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if (count != 0)
+                std::memcpy(static_cast<void*>(to), from, count * sizeof(T));
+        }
+        else {
+            std::uninitialized_move_n(from, count, to);
+            std::destroy_n(from, count);
+        }
+    }
+
+    /// Move the elements to a heap buffer of \p capacity.
+    void grow(size_type capacity) noexcept(false)
+    {
+        auto* const buffer = std::allocator<T>{}.allocate(capacity);
+        relocate(data_, size_, buffer);
+        this->free_heap();
+        data_     = buffer;
+        capacity_ = capacity;
+    }
+
+    template <typename... Arguments>
+    auto grow_and_emplace(Arguments&&... args) noexcept(false) -> T&
+    {
+        auto const capacity = 2 * capacity_;
+        auto* const buffer  = std::allocator<T>{}.allocate(capacity);
+        try {
+            ::new (static_cast<void*>(buffer + size_))
+                T(std::forward<Arguments>(args)...);
+        }
+        catch (...) {
+            std::allocator<T>{}.deallocate(buffer, capacity);
+            throw;
+        }
+        relocate(data_, size_, buffer);
+        this->free_heap();
+        data_     = buffer;
+        capacity_ = capacity;
+        return data_[size_++];
+    }
+
+    /// Take the elements of \p x, which is left empty and inline.
+    void take(Inline_vector& x) noexcept
+    {
+        if (x.is_inline()) {
+            relocate(x.data_, x.size_, data_);
+        }
+        else {
+            data_     = std::exchange(x.data_, x.inline_data());
+            capacity_ = std::exchange(x.capacity_, N);
+        }
+        size_ = std::exchange(x.size_, 0);
+    }
+
+    void free_heap() noexcept
+    {
+        if (!this->is_inline())
+            std::allocator<T>{}.deallocate(data_, capacity_);
+    }
+
+    void release() noexcept
+    {
+        this->clear();
+        this->free_heap();
+        data_     = this->inline_data();
+        capacity_ = N;
+    }
+};
+
+template <typename T>
+auto heap_bytes(std::vector<T> const& x) noexcept -> std::size_t
+{
+    return x.capacity() * sizeof(T);
+}
+
+template <typename T>
+auto heap_bytes(Relocating_vector<T> const& x) noexcept -> std::size_t
+{
+    return x.capacity() * sizeof(T);
+}
+
+template <typename T, std::size_t N, bool Grows>
+auto heap_bytes(Inline_vector<T, N, Grows> const& x) noexcept -> std::size_t
+{
+    return x.heap_bytes();
+}
+
+/// Slot storage over a contiguous Container, found by binary search.
+template <typename Container>
+class Sorted_slots {
+   public:
+    using value_type     = typename Container::value_type;
+    using iterator       = typename Container::iterator;
+    using const_iterator = typename Container::const_iterator;
+
+   public:
+    auto begin() noexcept -> iterator { return std::begin(slots_); }
+    auto begin() const noexcept -> const_iterator { return std::begin(slots_); }
+
+    auto end() noexcept -> iterator { return std::end(slots_); }
+    auto end() const noexcept -> const_iterator { return std::end(slots_); }
+
+    auto size() const noexcept -> std::size_t { return slots_.size(); }
+
+    auto empty() const noexcept -> bool { return slots_.empty(); }
+
+    auto back() const noexcept -> value_type const& { return slots_.back(); }
+
+    void push_back(value_type&& x) noexcept(false)
+    {
+        slots_.push_back(std::move(x));
+    }
+
+    template <typename Id>
+    auto find(Id id) noexcept -> iterator
+    {
+        auto const iter = std::lower_bound(
+            std::begin(slots_), std::end(slots_), id,
+            [](auto const& element, Id x) { return element.first < x; });
+        return iter != std::end(slots_) && iter->first == id ? iter
+                                                             : std::end(slots_);
+    }
+
+    void erase(iterator iter) noexcept { slots_.erase(iter); }
+
+    template <typename Predicate>
+    auto remove_if(Predicate predicate) noexcept -> std::size_t
+    {
+        auto const first =
+            std::remove_if(std::begin(slots_), std::end(slots_), predicate);
+        auto const count =
+            static_cast<std::size_t>(std::distance(first, std::end(slots_)));
+        slots_.erase(first, std::end(slots_));
+        return count;
+    }
+
+    void clear() noexcept { slots_.clear(); }
+
+    auto heap_bytes() const noexcept -> std::size_t
+    {
+        return detail::heap_bytes(slots_);
+    }
+
+   private:
+    Container slots_;
+};
+
+/// Slot storage that leaves a hole on erase, compacted later.
+/** Erase is a binary search and a destruction, with no elements shifted. The
+ *  holes are squeezed out once they outnumber the elements, so compaction is
+ *  amortized constant per erase. Identifiers are kept in a parallel array,
+ *  holes included, for the binary search. Iteration skips holes. */
+template <typename Element>
+class Tombstone_slots {
+    using Id_t      = typename Element::first_type;
+    using Entries_t = Slot_vector_t<std::optional<Element>>;
+
+    template <bool Const>
+    class Iterator {
+        using Base_t = std::conditional_t<Const,
+                                          typename Entries_t::const_iterator,
+                                          typename Entries_t::iterator>;
+
+       public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type        = Element;
+        using difference_type   = std::ptrdiff_t;
+        using pointer   = std::conditional_t<Const, Element const*, Element*>;
+        using reference = std::conditional_t<Const, Element const&, Element&>;
+
+       public:
+        Iterator() = default;
+
+        Iterator(Base_t pos, Base_t end) noexcept : pos_{pos}, end_{end}
+        {
+            this->skip_holes();
+        }
+
+        /// An iterator converts to a const_iterator.
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        Iterator(Iterator<false> const& x) noexcept
+            : pos_{x.pos_}, end_{x.end_}
+        {}
+
+        auto operator*() const noexcept -> reference { return **pos_; }
+
+        auto operator->() const noexcept -> pointer { return &**pos_; }
+
+        auto operator++() noexcept -> Iterator&
+        {
+            ++pos_;
+            this->skip_holes();
+            return *this;
+        }
+
+        auto operator++(int) noexcept -> Iterator
+        {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        /// Must not be begin(), so an element precedes it.
+        auto operator--() noexcept -> Iterator&
+        {
+            do {
+                --pos_;
+            } while (!pos_->has_value());
+            return *this;
+        }
+
+        auto operator--(int) noexcept -> Iterator
+        {
+            auto copy = *this;
+            --*this;
+            return copy;
+        }
+
+        friend auto operator==(Iterator const& x, Iterator const& y) noexcept
+            -> bool
+        {
+            return x.pos_ == y.pos_;
+        }
+
+        friend auto operator!=(Iterator const& x, Iterator const& y) noexcept
+            -> bool
+        {
+            return !(x == y);
+        }
+
+       private:
+        friend class Tombstone_slots;
+        friend class Iterator<true>;
+
+        Base_t pos_{};
+        Base_t end_{};
+
+       private:
+        void skip_holes() noexcept
+        {
+            while (pos_ != end_ && !pos_->has_value())
+                ++pos_;
+        }
+    };
+
+   public:
+    using value_type     = Element;
+    using iterator       = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+   public:
+    auto begin() noexcept -> iterator
+    {
+        return {std::begin(entries_), std::end(entries_)};
+    }
+    auto begin() const noexcept -> const_iterator
+    {
+        return {std::begin(entries_), std::end(entries_)};
+    }
+
+    auto end() noexcept -> iterator
+    {
+        return {std::end(entries_), std::end(entries_)};
+    }
+    auto end() const noexcept -> const_iterator
+    {
+        return {std::end(entries_), std::end(entries_)};
+    }
+
+    auto size() const noexcept -> std::size_t
+    {
+        return entries_.size() - holes_;
+    }
+
+    auto empty() const noexcept -> bool { return entries_.empty(); }
+
+    /// Never a hole, trailing holes are removed by erase.
+    auto back() const noexcept -> Element const& { return *entries_.back(); }
+
+    void push_back(Element&& x) noexcept(false)
+    {
+        ids_.push_back(x.first);
+        try {
+            entries_.push_back(std::optional<Element>{std::move(x)});
+        }
+        catch (...) {
+            ids_.pop_back();
+            throw;
+        }
+    }
+
+    auto find(Id_t id) noexcept -> iterator
+    {
+        auto const found =
+            std::lower_bound(std::begin(ids_), std::end(ids_), id);
+        if (found == std::end(ids_) || *found != id)
+            return this->end();
+        auto const pos = std::begin(entries_) + (found - std::begin(ids_));
+        return pos->has_value() ? iterator{pos, std::end(entries_)}
+                                : this->end();
+    }
+
+    void erase(iterator iter) noexcept
+    {
+        iter.pos_->reset();
+        ++holes_;
+        while (!entries_.empty() && !entries_.back().has_value()) {
+            entries_.erase(std::end(entries_) - 1);
+            ids_.pop_back();
+            --holes_;
+        }
+        if (holes_ > entries_.size() - holes_)
+            this->compact();
+    }
+
+    template <typename Predicate>
+    auto remove_if(Predicate predicate) noexcept -> std::size_t
+    {
+        auto count = std::size_t{0};
+        for (auto& entry : entries_) {
+            if (entry.has_value() && predicate(*entry)) {
+                entry.reset();
+                ++count;
+            }
+        }
+        holes_ += count;
+        this->compact();
+        return count;
+    }
+
+    void clear() noexcept
+    {
+        entries_.clear();
+        ids_.clear();
+        holes_ = 0;
+    }
+
+    auto heap_bytes() const noexcept -> std::size_t
+    {
+        return detail::heap_bytes(entries_) + detail::heap_bytes(ids_);
+    }
+
+   private:
+    Entries_t entries_;
+    std::vector<Id_t> ids_;
+    std::size_t holes_ = 0;
+
+   private:
+    /// Squeeze out every hole, keeping the order of the elements.
+    void compact() noexcept
+    {
+        if (holes_ == 0)
+            return;
+        auto kept = std::size_t{0};
+        for (auto i = std::size_t{0}; i < entries_.size(); ++i) {
+            if (!entries_[i].has_value())
+                continue;
+            if (kept != i) {
+                entries_[kept] = std::move(entries_[i]);
+                ids_[kept]     = ids_[i];
+            }
+            ++kept;
+        }
+        entries_.erase(std::begin(entries_) + kept, std::end(entries_));
+        ids_.erase(std::begin(ids_) + kept, std::end(ids_));
+        holes_ = 0;
+    }
+};
+
+}  // namespace sl::detail
+
+namespace sl {
+
+/// Slots in one heap array, the default. Relocated with memcpy if possible.
+struct Vector_storage {
+    template <typename Element>
+    using Container_t = detail::Sorted_slots<detail::Slot_vector_t<Element>>;
+};
+
+/// Up to N Slots inside the Signal, more move to the heap.
+/** For Signals that usually have few Slots, such as those of widgets. Each
+ *  inline Slot adds about 64 bytes to sizeof(Signal). */
+template <std::size_t N>
+struct Small_storage {
+    template <typename Element>
+    using Container_t =
+        detail::Sorted_slots<detail::Inline_vector<Element, N, true>>;
+};
+
+/// At most N Slots inside the Signal, connect never allocates.
+/** connect throws std::length_error once N Slots are connected. For real time
+ *  paths, together with Slot functions that fit in std::function. */
+template <std::size_t N>
+struct Fixed_storage {
+    template <typename Element>
+    using Container_t =
+        detail::Sorted_slots<detail::Inline_vector<Element, N, false>>;
+};
+
+/// Disconnect leaves a hole, compacted once holes outnumber the Slots.
+/** For Signals with many Slots and frequent disconnects, where shifting the
+ *  remaining Slots down on every disconnect dominates. */
+struct Slot_map_storage {
+    template <typename Element>
+    using Container_t = detail::Tombstone_slots<Element>;
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_SLOT_STORAGE_HPP
@@ -0,0 +1,239 @@
+#ifndef SIGNALS_LIGHT_SOCKET_BRIDGE_HPP
+#define SIGNALS_LIGHT_SOCKET_BRIDGE_HPP
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <signals_light/signal.hpp>
+
+namespace sl {
+
+// A Codec for a Signal<void(Args...)> is a type with the member functions:
+//
+//     void encode(std::string& out, Args const&... args);
+//     auto decode(std::string_view frame) -> std::tuple<std::decay_t<Args>...>;
+//
+// encode() appends one emission to out, decode() reverses it. Both sides of a
+// bridge must use the same Codec.
+
+/// Length prefix of each frame on the socket, in host byte order.
+using Frame_size_t = std::uint32_t;
+
+template <typename Signature, typename Codec>
+class Socket_sender;
+
+/// Serializes emissions into length prefixed frames on a socket.
+/** Frames are appended to a buffer, and written with a single sendmsg() per
+ *  flush(), which happens automatically once flush_threshold bytes are
+ *  buffered. Intended for AF_UNIX stream sockets. Not thread safe. */
+template <typename... Args, typename Codec>
+class Socket_sender<void(Args...), Codec> {
+   public:
+    /// Write frames to \p fd, which is not owned.
+    /** A \p flush_threshold of zero sends every emission immediately. */
+    explicit Socket_sender(int fd,
+                           Codec codec                 = Codec{},
+                           std::size_t flush_threshold = 64 * 1'024)
+        : fd_{fd}, codec_{std::move(codec)}, flush_threshold_{flush_threshold}
+    {}
+
+    Socket_sender(Socket_sender const&) = delete;
+    Socket_sender(Socket_sender&&)      = delete;
+    auto operator=(Socket_sender const&) -> Socket_sender& = delete;
+    auto operator=(Socket_sender&&) -> Socket_sender& = delete;
+
+    /// Does not flush, call flush() first to send buffered frames.
+    ~Socket_sender() = default;
+
+   public:
+    /// Encode one frame, flushing if the buffer reaches the threshold.
+    /** Throws std::length_error if the encoded frame is too large for the
+     *  length prefix, and anything flush() throws. If the Codec throws, the
+     *  partial frame is dropped and the exception propagated. */
+    void emit(Param_t<Args>... args) noexcept(false)
+    {
+        auto const start = buffer_.size();
+        buffer_.append(sizeof(Frame_size_t), '\0');
+        try {
+            codec_.encode(buffer_, args...);
+        }
+        catch (...) {
+            buffer_.resize(start);
+            throw;
+        }
+        auto const size = buffer_.size() - start - sizeof(Frame_size_t);
+        if (size > std::numeric_limits<Frame_size_t>::max()) {
+            buffer_.resize(start);
+            throw std::length_error{"Socket_sender: frame too large."};
+        }
+        auto const prefix = static_cast<Frame_size_t>(size);
+        std::memcpy(&buffer_[start], &prefix, sizeof(prefix));
+        ++frames_;
+        if (buffer_.size() - sent_ >= flush_threshold_)
+            this->flush();
+    }
+
+    /// Alternative notation for Socket_sender::emit.
+    void operator()(Param_t<Args>... args) noexcept(false)
+    {
+        this->emit(args...);
+    }
+
+    /// Return a Slot forwarding to emit(), it expires with *this.
+    auto slot() noexcept(false) -> Slot<void(Args...)>
+    {
+        auto s = Slot<void(Args...)>{
+            [this](Args const&... args) { this->emit(args...); }};
+        s.track(life_);
+        return s;
+    }
+
+    /// Send all buffered frames, with one sendmsg() call per batch.
+    /** Returns false if the socket is non-blocking and would block, the
+     *  remaining bytes stay buffered for the next flush(). Throws
+     *  std::system_error on any other failure. */
+    auto flush() noexcept(false) -> bool
+    {
+        while (sent_ != buffer_.size()) {
+            auto iov     = ::iovec{};
+            iov.iov_base = buffer_.data() + sent_;
+            iov.iov_len  = buffer_.size() - sent_;
+
+            auto msg       = ::msghdr{};
+            msg.msg_iov    = &iov;
+            msg.msg_iovlen = 1;
+
+            auto const n = ::sendmsg(fd_, &msg, MSG_NOSIGNAL);
+            if (n == -1) {
+                if (errno == EINTR)
+                    continue;
+                if (errno == EAGAIN || errno == EWOULDBLOCK)
+                    return false;
+                throw std::system_error{errno, std::system_category(),
+                                        "Socket_sender: sendmsg"};
+            }
+            ++syscalls_;
+            sent_ += static_cast<std::size_t>(n);
+        }
+        buffer_.clear();
+        sent_ = 0;
+        return true;
+    }
+
+    /// Return the number of encoded bytes not yet sent.
+    auto pending_bytes() const noexcept -> std::size_t
+    {
+        return buffer_.size() - sent_;
+    }
+
+    /// Return the number of frames encoded.
+    auto frame_count() const noexcept -> std::uint64_t { return frames_; }
+
+    /// Return the number of successful sendmsg() calls.
+    auto syscall_count() const noexcept -> std::uint64_t { return syscalls_; }
+
+   private:
+    int fd_;
+    Codec codec_;
+    std::size_t flush_threshold_;
+    std::string buffer_;
+    std::size_t sent_       = 0;
+    std::uint64_t frames_   = 0;
+    std::uint64_t syscalls_ = 0;
+    Lifetime life_;
+};
+
+template <typename Signature, typename Codec>
+class Socket_receiver;
+
+/// Decodes frames written by a Socket_sender and re-emits them locally.
+/** Not thread safe. */
+template <typename... Args, typename Codec>
+class Socket_receiver<void(Args...), Codec> : public Signal<void(Args...)> {
+   public:
+    /// Read frames from \p fd, which is not owned.
+    explicit Socket_receiver(int fd, Codec codec = Codec{})
+        : fd_{fd}, codec_{std::move(codec)}
+    {}
+
+    Socket_receiver(Socket_receiver const&) = delete;
+    Socket_receiver(Socket_receiver&&)      = delete;
+    auto operator=(Socket_receiver const&) -> Socket_receiver& = delete;
+    auto operator=(Socket_receiver&&) -> Socket_receiver& = delete;
+
+   public:
+    /// Make one read() and emit every complete frame received so far.
+    /** Blocks if the socket is blocking and nothing is available. Returns the
+     *  number of frames emitted, which can be zero if only part of a frame
+     *  arrived, the socket would block, or the peer closed it. Throws
+     *  std::system_error on read failure. */
+    auto receive() noexcept(false) -> std::size_t
+    {
+        auto n = ::read(fd_, chunk_.get(), chunk_size);
+        while (n == -1 && errno == EINTR)
+            n = ::read(fd_, chunk_.get(), chunk_size);
+        if (n == -1) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                return 0;
+            throw std::system_error{errno, std::system_category(),
+                                    "Socket_receiver: read"};
+        }
+        if (n == 0)
+            closed_ = true;
+        buffer_.append(chunk_.get(), static_cast<std::size_t>(n));
+        return this->dispatch();
+    }
+
+    /// Return true once the peer has closed the connection.
+    auto is_closed() const noexcept -> bool { return closed_; }
+
+   private:
+    static auto constexpr chunk_size = std::size_t{64 * 1'024};
+
+    int fd_;
+    Codec codec_;
+    std::unique_ptr<char[]> chunk_ = std::make_unique<char[]>(chunk_size);
+    std::string buffer_;  // Received bytes, starting at a frame boundary.
+    std::size_t parsed_ = 0;
+    bool closed_        = false;
+
+   private:
+    /// Emit each complete frame in the buffer, keep any trailing partial one.
+    auto dispatch() noexcept(false) -> std::size_t
+    {
+        auto emitted = std::size_t{0};
+        while (buffer_.size() - parsed_ >= sizeof(Frame_size_t)) {
+            auto size = Frame_size_t{0};
+            std::memcpy(&size, &buffer_[parsed_], sizeof(size));
+            auto const frame_end = parsed_ + sizeof(Frame_size_t) + size;
+            if (buffer_.size() < frame_end)
+                break;
+            auto const frame = std::string_view{buffer_}.substr(
+                parsed_ + sizeof(Frame_size_t), size);
+            parsed_ = frame_end;
+            std::apply([this](auto const&... args) { this->emit(args...); },
+                       codec_.decode(frame));
+            ++emitted;
+        }
+        buffer_.erase(0, parsed_);
+        parsed_ = 0;
+        return emitted;
+    }
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_SOCKET_BRIDGE_HPP
@@ -0,0 +1,344 @@
+#ifndef SIGNALS_LIGHT_STATS_EXPORT_HPP
+#define SIGNALS_LIGHT_STATS_EXPORT_HPP
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <signals_light/shm_signal.hpp>
+#include <signals_light/signal.hpp>
+
+namespace sl::detail {
+
+/// Layout at the start of a Stats_exporter segment, followed by the entries.
+struct Stats_header {
+    static auto constexpr magic_value = std::uint64_t{0x736c2d7374617431};
+
+    std::uint64_t magic;
+    std::uint64_t capacity;
+
+    /// Number of entries claimed, can exceed capacity if add() failed.
+    alignas(64) std::atomic<std::uint64_t> used;
+};
+
+/// Counters of one exported Signal, on its own cache lines.
+struct alignas(64) Stats_entry {
+    static auto constexpr name_size = std::size_t{48};
+
+    char name[name_size];
+    std::atomic<std::uint32_t> ready;  // Set once name is written.
+
+    alignas(64) std::atomic<std::uint64_t> emit_count;
+    std::atomic<std::uint64_t> slot_count;  // As of the last emission.
+    std::atomic<std::uint64_t> slot_calls;
+    std::atomic<std::uint64_t> total_ns;
+    std::atomic<std::uint64_t> max_ns;
+};
+
+/// Return the byte size of a segment holding \p capacity entries.
+inline auto stats_segment_size(std::size_t capacity) noexcept -> std::size_t
+{
+    auto constexpr align  = alignof(Stats_entry);
+    auto constexpr header = (sizeof(Stats_header) + align - 1) / align * align;
+    return header + capacity * sizeof(Stats_entry);
+}
+
+inline auto stats_entries(Shm_mapping const& mapping) noexcept -> Stats_entry*
+{
+    return reinterpret_cast<Stats_entry*>(static_cast<char*>(mapping.data()) +
+                                          stats_segment_size(0));
+}
+
+}  // namespace sl::detail
+
+namespace sl {
+
+/// Publishes per-Signal counters in a named shared memory segment.
+/** Exported_signals register an entry here and update it on every emit with
+ *  relaxed atomics, without locks or system calls. Any process can read the
+ *  segment with a Stats_reader, such as the signals_light_top tool. The
+ *  segment is unlinked when *this is destroyed. Linux only. */
+class Stats_exporter {
+   public:
+    /// Create the segment \p name, as for shm_open, with \p capacity entries.
+    /** Throws std::invalid_argument if \p capacity is zero, and
+     *  std::system_error if the segment can't be created, including if it
+     *  already exists. */
+    Stats_exporter(std::string name, std::size_t capacity) noexcept(false)
+        : name_{std::move(name)},
+          fd_{detail::check(::shm_open(name_.c_str(),
+                                       O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC,
+                                       0600),
+                            "Stats_exporter: shm_open")},
+          mapping_{init(name_, fd_, capacity)}
+    {}
+
+    Stats_exporter(Stats_exporter const&) = delete;
+    Stats_exporter(Stats_exporter&&)      = delete;
+    auto operator=(Stats_exporter const&) -> Stats_exporter& = delete;
+    auto operator=(Stats_exporter&&) -> Stats_exporter& = delete;
+
+    /// Readers keep their mapping, the counters stop changing.
+    ~Stats_exporter()
+    {
+        ::shm_unlink(name_.c_str());
+        ::close(fd_);
+    }
+
+   public:
+    /// Claim a new entry labelled \p label, truncated to fit.
+    /** Entries are never released. Throws std::length_error if all entries
+     *  are in use. Thread safe. */
+    auto add(std::string_view label) noexcept(false) -> detail::Stats_entry&
+    {
+        auto& header     = this->header();
+        auto const index = header.used.fetch_add(1, std::memory_order_relaxed);
+        if (index >= header.capacity)
+            throw std::length_error{"Stats_exporter: no free entries."};
+        auto& entry      = detail::stats_entries(mapping_)[index];
+        auto const count = std::min(label.size(), sizeof(entry.name) - 1);
+        std::memcpy(entry.name, label.data(), count);
+        entry.name[count] = '\0';
+        entry.ready.store(1, std::memory_order_release);
+        return entry;
+    }
+
+    /// Return the name given at construction.
+    auto name() const noexcept -> std::string const& { return name_; }
+
+    /// Return the maximum number of entries.
+    auto capacity() const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(this->header().capacity);
+    }
+
+   private:
+    std::string name_;
+    int fd_;
+    detail::Shm_mapping mapping_;
+
+   private:
+    auto header() const noexcept -> detail::Stats_header&
+    {
+        return *static_cast<detail::Stats_header*>(mapping_.data());
+    }
+
+    /// Size the segment at \p fd and map it with initialized entries.
+    static auto init(std::string const& name, int fd, std::size_t capacity)
+        noexcept(false) -> detail::Shm_mapping
+    {
+        try {
+            if (capacity == 0) {
+                throw std::invalid_argument{
+                    "Stats_exporter: capacity of zero."};
+            }
+            auto const size = detail::stats_segment_size(capacity);
+            detail::check(::ftruncate(fd, static_cast<::off_t>(size)),
+                          "Stats_exporter: ftruncate");
+            auto mapping        = detail::Shm_mapping{fd, size};
+            auto* const entries = detail::stats_entries(mapping);
+            for (auto i = std::size_t{0}; i < capacity; ++i)
+                ::new (&entries[i]) detail::Stats_entry{};
+            auto* header     = ::new (mapping.data()) detail::Stats_header{};
+            header->capacity = capacity;
+            std::atomic_thread_fence(std::memory_order_release);
+            header->magic = detail::Stats_header::magic_value;
+            return mapping;
+        }
+        catch (...) {
+            ::shm_unlink(name.c_str());
+            ::close(fd);
+            throw;
+        }
+    }
+};
+
+template <typename Signature>
+class Exported_signal;
+
+/// A Signal that counts its emissions in a Stats_exporter entry.
+/** Each emit records the slot count, the number of Slots invoked and the
+ *  emission's duration, read with steady_clock. Only emissions through
+ *  Exported_signal::emit are counted, not through a reference to the Signal
+ *  base class. The Stats_exporter must outlive *this. */
+template <typename R, typename... Args>
+class Exported_signal<R(Args...)> : public Signal<R(Args...)> {
+   public:
+    using Emit_result_t = typename Signal<R(Args...)>::Emit_result_t;
+
+   public:
+    /// Claim an entry labelled \p label in \p exporter.
+    /** Throws std::length_error if \p exporter has no free entries. */
+    Exported_signal(Stats_exporter& exporter,
+                    std::string_view label) noexcept(false)
+        : entry_{&exporter.add(label)}
+    {}
+
+   public:
+    /// Invoke all non-expired Slots, updating the exported counters.
+    auto emit(Param_t<Args>... args) const -> Emit_result_t
+    {
+        auto scope = Scope{*entry_, this->slot_count()};
+        return this->emit_with(
+            [&scope](Identifier, auto const& slot_fn, Param_t<Args>... args)
+                -> R {
+                scope.count_call();
+                return slot_fn(args...);
+            },
+            args...);
+    }
+
+    /// Alternative notation for Exported_signal::emit.
+    auto operator()(Param_t<Args>... args) const -> Emit_result_t
+    {
+        return this->emit(args...);
+    }
+
+   private:
+    using Clock = std::chrono::steady_clock;
+
+    /// Times one emission and records it when destroyed.
+    class Scope {
+       public:
+        Scope(detail::Stats_entry& entry, std::size_t slot_count) noexcept
+            : entry_{entry}, slot_count_{slot_count}, start_{Clock::now()}
+        {}
+
+        Scope(Scope const&) = delete;
+        auto operator=(Scope const&) -> Scope& = delete;
+
+        /// Count one Slot invocation, expired Slots are never counted.
+        void count_call() noexcept { ++calls_; }
+
+        ~Scope()
+        {
+            auto const ns = static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    Clock::now() - start_)
+                    .count());
+            auto constexpr relaxed = std::memory_order_relaxed;
+            entry_.emit_count.fetch_add(1, relaxed);
+            entry_.slot_count.store(slot_count_, relaxed);
+            entry_.slot_calls.fetch_add(calls_, relaxed);
+            entry_.total_ns.fetch_add(ns, relaxed);
+            auto max = entry_.max_ns.load(relaxed);
+            while (ns > max &&
+                   !entry_.max_ns.compare_exchange_weak(max, ns, relaxed)) {}
+        }
+
+       private:
+        detail::Stats_entry& entry_;
+        std::size_t slot_count_;
+        std::size_t calls_ = 0;
+        Clock::time_point start_;
+    };
+
+    detail::Stats_entry* entry_;
+};
+
+/// Read only view of a Stats_exporter segment, from any process.
+/** Linux only. */
+class Stats_reader {
+   public:
+    struct Entry {
+        std::size_t index;  // Position in the segment, fixed once claimed.
+        std::string name;
+        std::uint64_t emit_count;
+        std::uint64_t slot_count;
+        std::uint64_t slot_calls;
+        std::chrono::nanoseconds total_time;
+        std::chrono::nanoseconds max_time;
+    };
+
+   public:
+    /// Attach to the segment created by Stats_exporter(name, capacity).
+    /** Throws std::invalid_argument if the segment was not created by a
+     *  Stats_exporter, std::system_error if it can't be opened or mapped. */
+    explicit Stats_reader(std::string const& name) noexcept(false)
+        : Stats_reader{Fd{detail::check(
+              ::shm_open(name.c_str(), O_RDONLY | O_CLOEXEC, 0),
+              "Stats_reader: shm_open")}}
+    {}
+
+    Stats_reader(Stats_reader const&) = delete;
+    Stats_reader(Stats_reader&&)      = delete;
+    auto operator=(Stats_reader const&) -> Stats_reader& = delete;
+    auto operator=(Stats_reader&&) -> Stats_reader& = delete;
+
+   public:
+    /// Return the current counters of every registered entry.
+    /** Counters of one entry are read individually, so they may be from
+     *  different emissions. */
+    auto snapshot() const noexcept(false) -> std::vector<Entry>
+    {
+        auto const& header = *static_cast<detail::Stats_header*>(
+            mapping_.data());
+        auto const used = std::min(header.used.load(std::memory_order_relaxed),
+                                   header.capacity);
+        auto constexpr relaxed = std::memory_order_relaxed;
+        auto result            = std::vector<Entry>{};
+        result.reserve(used);
+        for (auto i = std::uint64_t{0}; i < used; ++i) {
+            auto const& e = detail::stats_entries(mapping_)[i];
+            if (e.ready.load(std::memory_order_acquire) == 0)
+                continue;
+            result.push_back(
+                {static_cast<std::size_t>(i), std::string{e.name},
+                 e.emit_count.load(relaxed), e.slot_count.load(relaxed),
+                 e.slot_calls.load(relaxed),
+                 std::chrono::nanoseconds{e.total_ns.load(relaxed)},
+                 std::chrono::nanoseconds{e.max_ns.load(relaxed)}});
+        }
+        return result;
+    }
+
+   private:
+    /// Closes a file descriptor owned only during construction.
+    struct Fd {
+        int value;
+        ~Fd() { ::close(value); }
+    };
+
+    detail::Shm_mapping mapping_;
+
+   private:
+    explicit Stats_reader(Fd const& fd) noexcept(false)
+        : mapping_{fd.value, validated_size(fd.value), PROT_READ}
+    {}
+
+    /// Return the segment size, after checking it holds a Stats_exporter.
+    static auto validated_size(int fd) noexcept(false) -> std::size_t
+    {
+        auto constexpr message = "Stats_reader: not a Stats_exporter segment.";
+        struct ::stat st       = {};
+        detail::check(::fstat(fd, &st), "Stats_reader: fstat");
+        auto const size = static_cast<std::size_t>(st.st_size);
+        if (size < sizeof(detail::Stats_header))
+            throw std::invalid_argument{message};
+        auto const probe =
+            detail::Shm_mapping{fd, sizeof(detail::Stats_header), PROT_READ};
+        auto const& header = *static_cast<detail::Stats_header*>(probe.data());
+        if (header.magic != detail::Stats_header::magic_value ||
+            detail::stats_segment_size(header.capacity) != size) {
+            throw std::invalid_argument{message};
+        }
+        return size;
+    }
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_STATS_EXPORT_HPP
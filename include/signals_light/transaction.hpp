@@ -0,0 +1,234 @@
+#ifndef SIGNALS_LIGHT_TRANSACTION_HPP
+#define SIGNALS_LIGHT_TRANSACTION_HPP
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <signals_light/signal.hpp>
+
+namespace sl::detail {
+
+/// Transactional_signals with a pending emission, in first emit order.
+struct Transaction_state {
+    struct Deferred {
+        void* signal;
+        void (*flush)(void* signal, bool emit);
+    };
+
+    int depth = 0;
+    std::vector<Deferred> pending;
+    std::vector<Deferred>* committing = nullptr;  // Being flushed by commit().
+
+    /// Forget \p signal, it is being destroyed.
+    void remove(void* signal) noexcept
+    {
+        for (auto* list : {&pending, committing}) {
+            if (list == nullptr)
+                continue;
+            for (auto& d : *list) {
+                if (d.signal == signal)
+                    d.signal = nullptr;
+            }
+        }
+    }
+
+    /// Return the state of the calling thread.
+    static auto local() -> Transaction_state&
+    {
+        thread_local auto state = Transaction_state{};
+        return state;
+    }
+};
+
+}  // namespace sl::detail
+
+namespace sl {
+
+/// Defers and merges emissions of Transactional_signals on this thread.
+/** While any Transaction is alive on a thread, emitting a Transactional_signal
+ *  on that thread only records its arguments. When the outermost Transaction
+ *  ends, each Transactional_signal emitted inside it is emitted once, with its
+ *  final or folded arguments, in the order of their first deferred emit.
+ *  Nested Transactions merge into the outermost one. */
+class Transaction {
+   public:
+    Transaction() noexcept : uncaught_{std::uncaught_exceptions()}
+    {
+        ++detail::Transaction_state::local().depth;
+    }
+
+    Transaction(Transaction const&) = delete;
+    Transaction(Transaction&&)      = delete;
+    auto operator=(Transaction const&) -> Transaction& = delete;
+    auto operator=(Transaction&&) -> Transaction& = delete;
+
+    /// Ends the scope, committing if this is the outermost Transaction.
+    /** If the scope is left by an exception, the deferred emissions of the
+     *  outermost Transaction are discarded instead. Anything a Slot throws
+     *  while committing propagates, call commit() to handle it explicitly. */
+    ~Transaction() noexcept(false)
+    {
+        if (committed_)
+            return;
+        auto& state = detail::Transaction_state::local();
+        if (state.depth > 1) {
+            --state.depth;
+            return;
+        }
+        if (std::uncaught_exceptions() > uncaught_) {
+            state.depth  = 0;
+            auto pending = std::move(state.pending);
+            state.pending.clear();
+            discard(pending, 0);
+            return;
+        }
+        this->commit();
+    }
+
+   public:
+    /// End the outermost Transaction now, emitting what it deferred.
+    /** Does nothing for a nested Transaction, or if already committed. Slots
+     *  that emit Transactional_signals while committing emit immediately. If a
+     *  Slot throws, the remaining deferred emissions are discarded. */
+    void commit() noexcept(false)
+    {
+        auto& state = detail::Transaction_state::local();
+        if (committed_ || state.depth > 1)
+            return;
+        committed_   = true;
+        state.depth  = 0;
+        auto pending = std::move(state.pending);
+        state.pending.clear();
+        auto* const outer = std::exchange(state.committing, &pending);
+        for (auto i = std::size_t{0}; i < pending.size(); ++i) {
+            try {
+                if (pending[i].signal != nullptr)
+                    pending[i].flush(pending[i].signal, true);
+            }
+            catch (...) {
+                discard(pending, i + 1);
+                state.committing = outer;
+                throw;
+            }
+        }
+        state.committing = outer;
+    }
+
+    /// Return true if a Transaction is alive on the calling thread.
+    static auto is_active() noexcept -> bool
+    {
+        return detail::Transaction_state::local().depth > 0;
+    }
+
+   private:
+    int uncaught_;
+    bool committed_ = false;
+
+   private:
+    /// Drop the deferred emissions of \p pending, starting at \p first.
+    static void discard(
+        std::vector<detail::Transaction_state::Deferred> const& pending,
+        std::size_t first) noexcept
+    {
+        for (auto i = first; i < pending.size(); ++i) {
+            if (pending[i].signal != nullptr)
+                pending[i].flush(pending[i].signal, false);
+        }
+    }
+};
+
+template <typename Signature>
+class Transactional_signal;
+
+/// A Signal whose emissions are deferred and merged inside a Transaction.
+/** Outside of a Transaction it behaves as a plain Signal. Inside one, only
+ *  the arguments are stored, each further emit replaces them, or is combined
+ *  with them by a user supplied fold. Only emissions through
+ *  Transactional_signal::emit are deferred, not through a reference to the
+ *  Signal base class. Can't be copied or moved while an emission is
+ *  pending, so neither is allowed. */
+template <typename... Args>
+class Transactional_signal<void(Args...)> : public Signal<void(Args...)> {
+   public:
+    using Tuple_t = std::tuple<std::decay_t<Args>...>;
+
+    /// Merges a new emission into the pending arguments, in place.
+    using Fold = std::function<void(Tuple_t& pending, Args const&... args)>;
+
+   public:
+    /// Keep only the last emitted arguments of a Transaction.
+    Transactional_signal() = default;
+
+    /// Merge the emissions of a Transaction with \p fold.
+    /** The first deferred emission is stored as is, \p fold is called for
+     *  every later one. */
+    explicit Transactional_signal(Fold fold) : fold_{std::move(fold)} {}
+
+    Transactional_signal(Transactional_signal const&) = delete;
+    Transactional_signal(Transactional_signal&&)      = delete;
+    auto operator=(Transactional_signal const&)
+        -> Transactional_signal& = delete;
+    auto operator=(Transactional_signal&&) -> Transactional_signal& = delete;
+
+    /// A pending emission is dropped.
+    ~Transactional_signal()
+    {
+        if (pending_)
+            detail::Transaction_state::local().remove(this);
+    }
+
+   public:
+    /// Emit now, or defer until the outermost Transaction ends.
+    void emit(Param_t<Args>... args) const
+    {
+        if (!Transaction::is_active()) {
+            Signal<void(Args...)>::emit(args...);
+            return;
+        }
+        if (!pending_) {
+            pending_.emplace(args...);
+            detail::Transaction_state::local().pending.push_back(
+                {const_cast<Transactional_signal*>(this), &flush});
+        }
+        else if (fold_) {
+            fold_(*pending_, args...);
+        }
+        else {
+            *pending_ = Tuple_t{args...};
+        }
+    }
+
+    /// Alternative notation for Transactional_signal::emit.
+    void operator()(Param_t<Args>... args) const { this->emit(args...); }
+
+    /// Return true if an emission is deferred in the current Transaction.
+    auto is_pending() const noexcept -> bool { return pending_.has_value(); }
+
+   private:
+    Fold fold_;
+    mutable std::optional<Tuple_t> pending_;
+
+   private:
+    /// Emit the pending arguments, or discard them if \p emit is false.
+    static void flush(void* signal, bool emit)
+    {
+        auto& self = *static_cast<Transactional_signal*>(signal);
+        auto args  = std::move(*self.pending_);
+        self.pending_.reset();
+        if (!emit)
+            return;
+        std::apply(
+            [&self](auto const&... xs) {
+                self.Signal<void(Args...)>::emit(xs...);
+            },
+            args);
+    }
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_TRANSACTION_HPP
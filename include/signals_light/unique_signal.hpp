@@ -0,0 +1,231 @@
+#ifndef SIGNALS_LIGHT_UNIQUE_SIGNAL_HPP
+#define SIGNALS_LIGHT_UNIQUE_SIGNAL_HPP
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#include <signals_light/signal.hpp>
+
+namespace sl {
+
+/// The identity of a Slot's callable, used to detect duplicate connections.
+/** Built from a function pointer, a member function pointer and the object it
+ *  is called on, or a user supplied key. Keys of different kinds never
+ *  compare equal. */
+class Slot_key {
+   public:
+    /// Identify a free function.
+    template <typename R, typename... Args>
+    Slot_key(R (*f)(Args...)) noexcept : kind_{Kind::Function}
+    {
+        this->store(f, nullptr);
+    }
+
+    /// Identify \p method called on \p object.
+    template <typename M, typename C>
+    Slot_key(M C::*method, void const* object) noexcept : kind_{Kind::Member}
+    {
+        this->store(method, object);
+    }
+
+    /// Identify a Slot by a key chosen by the caller.
+    static auto user(std::uint64_t key) noexcept -> Slot_key
+    {
+        auto result = Slot_key{Kind::User};
+        result.store(key, nullptr);
+        return result;
+    }
+
+   public:
+    friend auto operator==(Slot_key const& x, Slot_key const& y) noexcept
+        -> bool
+    {
+        return x.kind_ == y.kind_ && x.bytes_ == y.bytes_;
+    }
+
+    friend auto operator!=(Slot_key const& x, Slot_key const& y) noexcept
+        -> bool
+    {
+        return !(x == y);
+    }
+
+    /// Hash of the key's bytes.
+    struct Hash {
+        auto operator()(Slot_key const& key) const noexcept -> std::size_t
+        {
+            auto const bytes = std::string_view{
+                reinterpret_cast<char const*>(key.bytes_.data()),
+                key.bytes_.size()};
+            return std::hash<std::string_view>{}(bytes) ^
+                   static_cast<std::size_t>(key.kind_);
+        }
+    };
+
+   private:
+    enum class Kind : std::uint8_t { Function, Member, User };
+
+    static auto constexpr callable_size = 2 * sizeof(void*);
+
+    Kind kind_;
+    // The callable's bytes, zero padded, then the object pointer.
+    std::array<unsigned char, callable_size + sizeof(void*)> bytes_{};
+
+   private:
+    explicit Slot_key(Kind kind) noexcept : kind_{kind} {}
+
+    template <typename Callable>
+    void store(Callable const& callable, void const* object) noexcept
+    {
+        static_assert(sizeof(Callable) <= callable_size,
+                      "Slot_key: Member function pointer too large.");
+        std::memcpy(bytes_.data(), &callable, sizeof(Callable));
+        std::memcpy(bytes_.data() + callable_size, &object, sizeof(object));
+    }
+};
+
+/// What connect_unique does when a Slot with the same key is connected.
+enum class Duplicate {
+    Refuse,   // Keep the connected Slot, discard the new one.
+    Replace,  // Disconnect the connected Slot, then connect the new one.
+};
+
+template <typename Signature>
+class Unique_signal;
+
+/// A Signal that can refuse or replace Slots with an already connected key.
+/** Keys are looked up in a hash index, so connect_unique is O(1) on average
+ *  however many Slots are connected. Slots connected with plain connect have
+ *  no key and are never duplicates. Disconnecting through a reference to the
+ *  Signal base class leaves the key indexed, so contains reports it until
+ *  connect_unique finds its Slot gone. Pass *this itself to a Signal_base.
+ *  A key stays connected when its Slot expires, until it is disconnected or
+ *  removed by purge_expired. */
+template <typename R, typename... Args>
+class Unique_signal<R(Args...)> : public Signal<R(Args...)> {
+   public:
+    using Signature_t = R(Args...);
+
+   public:
+    /// Register \p s unless a Slot with \p key is connected.
+    /** Returns the Identifier of the Slot connected under \p key afterwards,
+     *  and true if that is \p s. With Duplicate::Replace, \p s is always
+     *  connected, last, and the old Slot is disconnected. */
+    auto connect_unique(Slot_key const& key,
+                        Slot<Signature_t> s,
+                        Duplicate on_duplicate = Duplicate::Refuse)
+        noexcept(false) -> std::pair<Identifier, bool>
+    {
+        if (auto const found = by_key_.find(key); found != std::end(by_key_)) {
+            auto const old_id = found->second;
+            if (!this->is_connected(old_id))  // Disconnected through the base.
+                this->forget(old_id);
+            else if (on_duplicate == Duplicate::Refuse)
+                return {old_id, false};
+            else
+                this->disconnect(old_id);
+        }
+        auto const id = Signal<R(Args...)>::connect(std::move(s));
+        try {
+            by_key_.emplace(key, id);
+            by_id_.emplace(id, key);
+        }
+        catch (...) {
+            this->disconnect(id);
+            throw;
+        }
+        return {id, true};
+    }
+
+    /// Register the free function \p f, keyed on its address.
+    template <typename Result, typename... Params>
+    auto connect_unique(Result (*f)(Params...),
+                        Duplicate on_duplicate = Duplicate::Refuse)
+        noexcept(false) -> std::pair<Identifier, bool>
+    {
+        return this->connect_unique(Slot_key{f}, Slot<Signature_t>{f},
+                                    on_duplicate);
+    }
+
+    /// Register \p method called on \p object, keyed on both.
+    /** \p object must outlive the connection. */
+    template <typename M, typename C, typename T>
+    auto connect_unique(M C::*method,
+                        T& object,
+                        Duplicate on_duplicate = Duplicate::Refuse)
+        noexcept(false) -> std::pair<Identifier, bool>
+    {
+        static_assert(std::is_member_function_pointer_v<M C::*>,
+                      "Unique_signal: method must be a member function.");
+        return this->connect_unique(
+            Slot_key{method, &object},
+            Slot<Signature_t>{[method, &object](Args... args) -> R {
+                return (object.*method)(std::forward<Args>(args)...);
+            }},
+            on_duplicate);
+    }
+
+    /// Removes and returns the Slot associated with \p id, and its key.
+    /** Throws std::invalid_argument if no connected Slot is found with id. */
+    auto disconnect(Identifier id) noexcept(false) -> Slot<Signature_t>
+    {
+        auto slot = Signal<R(Args...)>::disconnect(id);
+        this->forget(id);
+        return slot;
+    }
+
+    /// Disconnect every expired Slot, and the keys they were connected under.
+    /** Returns the number of Slots disconnected. */
+    auto purge_expired() noexcept -> std::size_t
+    {
+        auto const count = Signal<R(Args...)>::purge_expired();
+        if (count == 0)
+            return 0;
+        for (auto iter = std::begin(by_id_); iter != std::end(by_id_);) {
+            if (this->is_connected(iter->first)) {
+                ++iter;
+                continue;
+            }
+            by_key_.erase(iter->second);
+            iter = by_id_.erase(iter);
+        }
+        return count;
+    }
+
+    /// Disconnect every Slot and forget every key.
+    void disconnect_all() noexcept
+    {
+        Signal<R(Args...)>::disconnect_all();
+        by_key_.clear();
+        by_id_.clear();
+    }
+
+    /// Return true if a Slot is connected under \p key.
+    auto contains(Slot_key const& key) const -> bool
+    {
+        return by_key_.count(key) != 0;
+    }
+
+   private:
+    std::unordered_map<Slot_key, Identifier, Slot_key::Hash> by_key_;
+    std::map<Identifier, Slot_key> by_id_;
+
+   private:
+    /// Remove the key of \p id from the index, if it has one.
+    void forget(Identifier id) noexcept
+    {
+        if (auto const found = by_id_.find(id); found != std::end(by_id_)) {
+            by_key_.erase(found->second);
+            by_id_.erase(found);
+        }
+    }
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_UNIQUE_SIGNAL_HPP
@@ -0,0 +1,164 @@
+#ifndef SIGNALS_LIGHT_VARIANT_SLOTS_HPP
+#define SIGNALS_LIGHT_VARIANT_SLOTS_HPP
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <signals_light/signal.hpp>
+
+namespace sl {
+
+template <typename Signature, typename... Fs>
+class Variant_slots_signal;
+
+/// A Signal whose Slots can only be one of the callable types \p Fs.
+/** Slot functions are stored by value in a std::variant, contiguously, and
+ *  invoked through a switch on the variant index the compiler can inline,
+ *  rather than through std::function's type erasure. Any number of Slots of
+ *  each type can be connected, each optionally tracking one lifetime. */
+template <typename R, typename... Args, typename... Fs>
+class Variant_slots_signal<R(Args...), Fs...> {
+    static_assert(sizeof...(Fs) > 0,
+                  "Variant_slots_signal: At least one callable type needed.");
+    static_assert((std::is_invocable_r_v<R, Fs const&, Args const&...> && ...),
+                  "Variant_slots_signal: Callable types must be invocable.");
+
+   public:
+    using Signature_t = R(Args...);
+    using Emit_result_t =
+        std::conditional_t<std::is_same_v<void, R>, void, std::optional<R>>;
+    using Function_t = std::variant<Fs...>;
+
+   public:
+    /// Invoke all non-expired Slots.
+    /** Returns the return value of the last connected Slot or std::nullopt if
+     *  none. Expired Slots are ignored, rather than throwing an exception. */
+    auto emit(Param_t<Args>... args) const -> Emit_result_t
+    {
+        auto const scope = detail::Emission_scope{};
+        if constexpr (std::is_same_v<void, R>) {
+            for (auto const& slot : slots_) {
+                if (!slot.is_expired())
+                    invoke(slot.f, args...);
+            }
+        }
+        else {
+            auto const last_valid_iter = std::find_if(
+                std::crbegin(slots_), std::crend(slots_),
+                [](auto const& slot) { return !slot.is_expired(); });
+            if (last_valid_iter == std::crend(slots_))
+                return std::nullopt;
+            for (auto const& slot : slots_) {
+                if (slot.is_expired())
+                    continue;
+                if (&slot == &*last_valid_iter)
+                    return invoke(slot.f, args...);
+                invoke(slot.f, args...);
+            }
+            return std::nullopt;
+        }
+    }
+
+    /// Alternative notation for Variant_slots_signal::emit.
+    auto operator()(Param_t<Args>... args) const -> Emit_result_t
+    {
+        return this->emit(args...);
+    }
+
+    /// Register \p f, which must be one of Fs..., with *this.
+    /** Returns a unique Identifier, to be used with disconnect. An Identifier
+     *  is not reused after its Slot is disconnected. */
+    template <typename F>
+    auto connect(F&& f) noexcept(false) -> Identifier
+    {
+        static_assert((std::is_same_v<std::decay_t<F>, Fs> || ...),
+                      "Variant_slots_signal: F is not one of the Fs.");
+        return this->add(Function_t{std::forward<F>(f)}, std::nullopt);
+    }
+
+    /// Register \p f, it will not be invoked once \p tracked has expired.
+    template <typename F>
+    auto connect(F&& f, Lifetime_observer tracked) noexcept(false)
+        -> Identifier
+    {
+        static_assert((std::is_same_v<std::decay_t<F>, Fs> || ...),
+                      "Variant_slots_signal: F is not one of the Fs.");
+        return this->add(Function_t{std::forward<F>(f)}, std::move(tracked));
+    }
+
+    /// Register \p f, it will not be invoked once \p tracked is destroyed.
+    template <typename F>
+    auto connect(F&& f, Lifetime const& tracked) noexcept(false) -> Identifier
+    {
+        return this->connect(std::forward<F>(f), tracked.track());
+    }
+
+    /// Removes and returns the slot function associated with \p id.
+    /** Throws std::invalid_argument if no connected Slot is found with id. */
+    auto disconnect(Identifier id) noexcept(false) -> Function_t
+    {
+        auto const iter =
+            std::find_if(std::begin(slots_), std::end(slots_),
+                         [id](auto const& slot) { return slot.id == id; });
+        if (iter == std::end(slots_)) {
+            throw std::invalid_argument{
+                "Variant_slots_signal::disconnect: No matching id."};
+        }
+        auto f = std::move(iter->f);
+        slots_.erase(iter);
+        return f;
+    }
+
+    /// Return the number of connected Slots.
+    auto slot_count() const noexcept -> std::size_t { return slots_.size(); }
+
+    /// Return true if there are no connected Slots.
+    auto is_empty() const noexcept -> bool { return slots_.empty(); }
+
+   private:
+    struct Entry {
+        Identifier id;
+        Function_t f;
+        std::optional<Lifetime_observer> tracked;
+
+        auto is_expired() const noexcept -> bool
+        {
+            return tracked.has_value() && tracked->is_expired();
+        }
+    };
+
+    std::vector<Entry> slots_;
+    Identifier next_id_;  // Never reused, so an old id can't match a new Slot.
+
+   private:
+    auto add(Function_t f, std::optional<Lifetime_observer> tracked)
+        noexcept(false) -> Identifier
+    {
+        auto const id = next_id_;
+        slots_.push_back({id, std::move(f), std::move(tracked)});
+        next_id_ = Identifier::next(id);
+        return id;
+    }
+
+    /// Call the alternative held by \p f, an if chain on the index.
+    template <std::size_t I = 0>
+    static auto invoke(Function_t const& f, Param_t<Args>... args) -> R
+    {
+        if constexpr (I + 1 == sizeof...(Fs)) {
+            return (*std::get_if<I>(&f))(args...);
+        }
+        else {
+            if (f.index() == I)
+                return (*std::get_if<I>(&f))(args...);
+            return invoke<I + 1>(f, args...);
+        }
+    }
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_VARIANT_SLOTS_HPP
@@ -0,0 +1,116 @@
+#ifndef SIGNALS_LIGHT_WAIT_HPP
+#define SIGNALS_LIGHT_WAIT_HPP
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+
+#include <signals_light/detail/futex.hpp>
+#include <signals_light/signal.hpp>
+
+namespace sl {
+
+template <typename Signature>
+class Emission_waiter;
+
+/// Lets other threads block until a Signal is next emitted.
+/** Construct on the thread that owns the Signal, wait_next() can then be
+ *  called from any number of threads. While nobody is waiting, an emission
+ *  costs a single atomic load. Waiters are woken through a futex.
+ *  Linux only. */
+template <typename... Args>
+class Emission_waiter<void(Args...)> {
+   public:
+    using Tuple_t = std::tuple<std::decay_t<Args>...>;
+
+   public:
+    /// Connect a Slot to \p signal, it expires when *this is destroyed.
+    explicit Emission_waiter(Signal<void(Args...)>& signal) noexcept(false)
+        : state_{std::make_shared<State>()}
+    {
+        auto slot = Slot<void(Args...)>{[state = state_](Args const&... args) {
+            if (state->waiters.load(std::memory_order_seq_cst) == 0)
+                return;
+            {
+                auto const lock = std::lock_guard{state->mtx};
+                state->last.emplace(args...);
+                state->seq.fetch_add(1, std::memory_order_release);
+            }
+            detail::futex_wake_all(state->seq);
+        }};
+        slot.track(life_);
+        signal.connect(std::move(slot));
+    }
+
+    Emission_waiter(Emission_waiter const&) = delete;
+    Emission_waiter(Emission_waiter&&)      = delete;
+    auto operator=(Emission_waiter const&) -> Emission_waiter& = delete;
+    auto operator=(Emission_waiter&&) -> Emission_waiter& = delete;
+
+   public:
+    /// Block until the Signal is emitted, or \p timeout elapses.
+    /** Returns a copy of the emitted arguments, or std::nullopt on timeout. If
+     *  emissions happen in quick succession the most recent arguments are
+     *  returned. The sequence is read before the caller is counted by
+     *  waiter_count(), so any emission after that wakes it. */
+    template <typename Rep, typename Period>
+    auto wait_next(std::chrono::duration<Rep, Period> timeout) const
+        noexcept(false) -> std::optional<Tuple_t>
+    {
+        using Clock = std::chrono::steady_clock;
+        auto const deadline =
+            Clock::now() +
+            std::chrono::duration_cast<Clock::duration>(timeout);
+
+        // An emission either sees the new waiter or bumps seq past this value.
+        auto const seq = state_->seq.load(std::memory_order_seq_cst);
+        state_->waiters.fetch_add(1, std::memory_order_seq_cst);
+        auto result = std::optional<Tuple_t>{};
+        while (true) {
+            if (state_->seq.load(std::memory_order_acquire) != seq) {
+                auto const lock = std::lock_guard{state_->mtx};
+                result          = state_->last;
+                break;
+            }
+            if (!detail::futex_wait(state_->seq, seq, deadline - Clock::now()))
+                break;
+        }
+        state_->waiters.fetch_sub(1, std::memory_order_relaxed);
+        return result;
+    }
+
+    /// Return the number of threads currently blocked in wait_next().
+    auto waiter_count() const noexcept -> std::uint32_t
+    {
+        return state_->waiters.load(std::memory_order_relaxed);
+    }
+
+   private:
+    /// Shared with the connected Slot, which can outlive *this.
+    struct State {
+        std::atomic<std::uint32_t> seq     = 0;  // Futex word.
+        std::atomic<std::uint32_t> waiters = 0;
+        std::mutex mtx;
+        std::optional<Tuple_t> last;
+    };
+
+    std::shared_ptr<State> state_;
+    Lifetime life_;
+};
+
+/// Block until \p waiter's Signal is emitted, or \p timeout elapses.
+/** Returns a copy of the emitted arguments, or std::nullopt on timeout. */
+template <typename... Args, typename Rep, typename Period>
+auto wait_next(Emission_waiter<void(Args...)> const& waiter,
+               std::chrono::duration<Rep, Period> timeout) noexcept(false)
+    -> std::optional<std::tuple<std::decay_t<Args>...>>
+{
+    return waiter.wait_next(timeout);
+}
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_WAIT_HPP
@@ -0,0 +1,104 @@
+#ifndef SIGNALS_LIGHT_WATCHDOG_HPP
+#define SIGNALS_LIGHT_WATCHDOG_HPP
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include <signals_light/signal.hpp>
+
+namespace sl {
+
+template <typename Signature>
+class Watchdog_signal;
+
+/// A Signal that reports Slot invocations exceeding a time budget.
+/** Without a budget set, emit() is a plain Signal emit plus one branch. With a
+ *  budget, each Slot invocation is bracketed by two steady_clock reads and the
+ *  handler is called after any invocation that took longer than the budget.
+ *  Only emissions through Watchdog_signal::emit are timed, not through a
+ *  reference to the Signal base class. */
+template <typename R, typename... Args>
+class Watchdog_signal<R(Args...)> : public Signal<R(Args...)> {
+   public:
+    using Emit_result_t = typename Signal<R(Args...)>::Emit_result_t;
+    using Clock         = std::chrono::steady_clock;
+
+    /// Called with the emitting Signal, the slow Slot and its duration.
+    using Handler = std::function<
+        void(Signal<R(Args...)> const&, Identifier, Clock::duration)>;
+
+   public:
+    /// Invoke \p on_overrun whenever a Slot invocation exceeds \p budget.
+    /** Replaces any previous budget. Throws std::invalid_argument if
+     *  \p on_overrun is empty. */
+    void set_budget(Clock::duration budget, Handler on_overrun) noexcept(false)
+    {
+        if (!on_overrun)
+            throw std::invalid_argument{"Watchdog_signal: empty handler."};
+        budget_     = budget;
+        on_overrun_ = std::move(on_overrun);
+    }
+
+    /// Stop timing Slot invocations.
+    void clear_budget() noexcept
+    {
+        budget_     = {};
+        on_overrun_ = nullptr;
+    }
+
+    /// Return the current budget, or std::nullopt if none is set.
+    auto budget() const noexcept -> std::optional<Clock::duration>
+    {
+        if (!on_overrun_)
+            return std::nullopt;
+        return budget_;
+    }
+
+    /// Invoke all non-expired Slots, timing each if a budget is set.
+    /** The handler is invoked synchronously, after the slow Slot returns. An
+     *  invocation that throws is not reported. */
+    auto emit(Param_t<Args>... args) const -> Emit_result_t
+    {
+        if (!on_overrun_)
+            return Signal<R(Args...)>::emit(args...);
+        return this->emit_with(
+            [this](Identifier id, auto const& slot_fn, Param_t<Args>... args)
+                -> R {
+                auto const start = Clock::now();
+                if constexpr (std::is_same_v<void, R>) {
+                    slot_fn(args...);
+                    this->check(id, start);
+                }
+                else {
+                    auto result = slot_fn(args...);
+                    this->check(id, start);
+                    return result;
+                }
+            },
+            args...);
+    }
+
+    /// Alternative notation for Watchdog_signal::emit.
+    auto operator()(Param_t<Args>... args) const -> Emit_result_t
+    {
+        return this->emit(args...);
+    }
+
+   private:
+    Clock::duration budget_ = {};
+    Handler on_overrun_;
+
+   private:
+    void check(Identifier id, Clock::time_point start) const
+    {
+        auto const elapsed = Clock::now() - start;
+        if (elapsed > budget_)
+            on_overrun_(*this, id, elapsed);
+    }
+};
+
+}  // namespace sl
+#endif  // SIGNALS_LIGHT_WATCHDOG_HPP
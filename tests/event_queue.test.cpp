@@ -0,0 +1,235 @@
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/event_queue.hpp>
+#include <signals_light/signal.hpp>
+
+TEST_CASE("Event_queue runs posted tasks in order", "[Event_queue]")
+{
+    auto queue  = sl::Event_queue{};
+    auto result = std::vector<int>{};
+    REQUIRE(queue.is_empty());
+    REQUIRE(queue.process_events() == 0);
+
+    for (auto i = 0; i < 5; ++i)
+        queue.post([&result, i] { result.push_back(i); });
+    REQUIRE(!queue.is_empty());
+    REQUIRE(result.empty());
+
+    REQUIRE(queue.process_events() == 5);
+    REQUIRE(result == std::vector<int>{0, 1, 2, 3, 4});
+    REQUIRE(queue.is_empty());
+}
+
+TEST_CASE("Event_queue coalesces wakeups on its eventfd", "[Event_queue]")
+{
+    auto queue = sl::Event_queue{};
+    for (auto i = 0; i < 100; ++i)
+        queue.post([] {});
+
+    auto count = std::uint64_t{0};
+    REQUIRE(::read(queue.fd(), &count, sizeof(count)) == sizeof(count));
+    REQUIRE(count == 1);
+    REQUIRE(queue.process_events() == 100);
+}
+
+TEST_CASE("Event_queue keeps the batch if a task throws", "[Event_queue]")
+{
+    auto queue = sl::Event_queue{};
+    auto ran   = 0;
+    queue.post([&ran] { ++ran; });
+    queue.post([] { throw std::runtime_error{"task"}; });
+    queue.post([&ran] { ++ran; });
+
+    REQUIRE_THROWS_AS(queue.process_events(), std::runtime_error);
+    REQUIRE(ran == 1);
+    REQUIRE(queue.process_events() == 1);
+    REQUIRE(ran == 2);
+}
+
+TEST_CASE("Queued Slots deliver emissions from other threads through epoll",
+          "[Event_queue]")
+{
+    auto queue    = sl::Event_queue{};
+    auto sig      = sl::Signal<void(int, std::string const&)>{};
+    auto received = std::vector<std::string>{};
+    auto sum      = 0;
+    sig.connect(sl::queued(queue, sl::Slot<void(int, std::string const&)>{
+                                      [&](int i, std::string const& s) {
+                                          sum += i;
+                                          received.push_back(s);
+                                      }}));
+
+    auto constexpr count = 1'000;
+    auto producer        = std::thread{[&sig] {
+        for (auto i = 0; i < count; ++i)
+            sig(1, std::to_string(i));
+    }};
+
+    auto const epfd = ::epoll_create1(EPOLL_CLOEXEC);
+    REQUIRE(epfd != -1);
+    auto ev    = ::epoll_event{};
+    ev.events  = EPOLLIN;
+    ev.data.fd = queue.fd();
+    REQUIRE(::epoll_ctl(epfd, EPOLL_CTL_ADD, queue.fd(), &ev) == 0);
+
+    while (sum < count) {
+        auto ready = ::epoll_event{};
+        if (::epoll_wait(epfd, &ready, 1, 1'000) == 1)
+            queue.process_events();
+    }
+    producer.join();
+    ::close(epfd);
+
+    REQUIRE(sum == count);
+    REQUIRE(received.front() == "0");
+    REQUIRE(received.back() == std::to_string(count - 1));
+}
+
+TEST_CASE("Queued Slots check tracked Lifetimes at delivery", "[Event_queue]")
+{
+    auto queue = sl::Event_queue{};
+    auto sig   = sl::Signal<void()>{};
+    auto calls = 0;
+    {
+        auto life = sl::Lifetime{};
+        auto slot = sl::Slot<void()>{[&calls] { ++calls; }};
+        slot.track(life);
+        sig.connect(sl::queued(queue, slot));
+        sig();
+    }
+    REQUIRE(queue.process_events() == 1);
+    REQUIRE(calls == 0);
+}
+
+TEST_CASE("Bounded_event_queue Overflow policies", "[Event_queue]")
+{
+    auto result = std::vector<int>{};
+    auto push   = [&result](int i) {
+        return [&result, i] { result.push_back(i); };
+    };
+
+    SECTION("Drop_newest discards posts while full")
+    {
+        auto queue = sl::Bounded_event_queue{2, sl::Overflow::Drop_newest};
+        REQUIRE(queue.post(push(1)));
+        REQUIRE(queue.post(push(2)));
+        REQUIRE(!queue.post(push(3)));
+        REQUIRE(queue.size() == 2);
+        REQUIRE(queue.dropped() == 1);
+        REQUIRE(queue.process_events() == 2);
+        REQUIRE(result == std::vector<int>{1, 2});
+    }
+
+    SECTION("Drop_oldest discards the oldest pending task")
+    {
+        auto queue = sl::Bounded_event_queue{2, sl::Overflow::Drop_oldest};
+        for (auto i = 1; i <= 5; ++i)
+            REQUIRE(queue.post(push(i)));
+        REQUIRE(queue.dropped() == 3);
+        REQUIRE(queue.process_events() == 2);
+        REQUIRE(result == std::vector<int>{4, 5});
+    }
+
+    SECTION("Coalesce replaces pending tasks with the same key in place")
+    {
+        auto queue = sl::Bounded_event_queue{3, sl::Overflow::Coalesce};
+        REQUIRE(queue.post(7, push(1)));
+        REQUIRE(queue.post(8, push(2)));
+        REQUIRE(queue.post(7, push(3)));
+        REQUIRE(queue.post(push(4)));
+        REQUIRE(queue.post(8, push(5)));
+        REQUIRE(!queue.post(9, push(6)));
+        REQUIRE(queue.coalesced() == 2);
+        REQUIRE(queue.dropped() == 1);
+        REQUIRE(queue.process_events() == 3);
+        REQUIRE(result == std::vector<int>{3, 5, 4});
+
+        // Keys are forgotten once processed.
+        REQUIRE(queue.post(7, push(7)));
+        REQUIRE(queue.process_events() == 1);
+        REQUIRE(result.back() == 7);
+    }
+
+    SECTION("Block waits for the consumer to make room")
+    {
+        auto queue = sl::Bounded_event_queue{1, sl::Overflow::Block};
+        REQUIRE(queue.post(push(1)));
+        auto producer = std::thread{[&] { queue.post(push(2)); }};
+        while (result.size() < 2)
+            queue.process_events();
+        producer.join();
+        REQUIRE(result == std::vector<int>{1, 2});
+        REQUIRE(queue.dropped() == 0);
+    }
+
+    SECTION("The batch is kept if a task throws")
+    {
+        auto queue = sl::Bounded_event_queue{2, sl::Overflow::Drop_newest};
+        REQUIRE(queue.post([] { throw std::runtime_error{"task"}; }));
+        REQUIRE(queue.post(push(1)));
+        REQUIRE_THROWS_AS(queue.process_events(), std::runtime_error);
+        REQUIRE(result.empty());
+
+        auto count = std::uint64_t{0};
+        REQUIRE(::read(queue.fd(), &count, sizeof(count)) == sizeof(count));
+        REQUIRE(queue.post(push(2)));
+        REQUIRE(queue.post(push(3)));
+        REQUIRE(queue.process_events() == 3);
+        REQUIRE(result == std::vector<int>{1, 2, 3});
+        REQUIRE(queue.dropped() == 0);
+    }
+
+    SECTION("Tasks kept over repeated throws run in order")
+    {
+        auto queue = sl::Bounded_event_queue{2, sl::Overflow::Drop_newest};
+        auto fail  = [] { throw std::runtime_error{"task"}; };
+        REQUIRE(queue.post(fail));
+        REQUIRE(queue.post(push(1)));
+        REQUIRE_THROWS_AS(queue.process_events(), std::runtime_error);
+        REQUIRE(queue.post(fail));
+        REQUIRE(queue.post(push(2)));
+        REQUIRE_THROWS_AS(queue.process_events(), std::runtime_error);
+        REQUIRE(result == std::vector<int>{1});
+
+        REQUIRE(queue.post(push(3)));
+        REQUIRE(queue.post(push(4)));
+        REQUIRE(queue.process_events() == 3);
+        REQUIRE(result == std::vector<int>{1, 2, 3, 4});
+    }
+
+    SECTION("Zero capacity throws")
+    {
+        REQUIRE_THROWS_AS(sl::Bounded_event_queue(0, sl::Overflow::Block),
+                          std::invalid_argument);
+    }
+}
+
+TEST_CASE("Queued Slots can coalesce emissions by key", "[Event_queue]")
+{
+    auto queue  = sl::Bounded_event_queue{16, sl::Overflow::Coalesce};
+    auto latest = std::vector<std::pair<int, int>>{};
+    auto sig    = sl::Signal<void(int, int)>{};
+    sig.connect(sl::queued(
+        queue,
+        sl::Slot<void(int, int)>{
+            [&latest](int id, int value) { latest.push_back({id, value}); }},
+        [](int id, int) { return static_cast<std::uint64_t>(id); }));
+
+    for (auto value = 0; value < 10; ++value) {
+        sig(1, value);
+        sig(2, value * 2);
+    }
+    REQUIRE(queue.coalesced() == 18);
+    REQUIRE(queue.process_events() == 2);
+    REQUIRE(latest == std::vector<std::pair<int, int>>{{1, 9}, {2, 18}});
+}
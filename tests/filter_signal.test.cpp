@@ -0,0 +1,111 @@
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/filter_signal.hpp>
+
+TEST_CASE("Filter_signal stops at the first Slot returning true",
+          "[Filter_signal]")
+{
+    auto sig   = sl::Filter_signal<bool(int)>{};
+    auto tried = std::vector<int>{};
+    sig.connect([&](int x) {
+        tried.push_back(1);
+        return x == 1;
+    });
+    sig.connect([&](int x) {
+        tried.push_back(2);
+        return x == 2;
+    });
+    REQUIRE(sig.order() == sl::Slot_order::Connection);
+
+    REQUIRE(sig(1));
+    REQUIRE(tried == std::vector<int>{1});
+    tried.clear();
+    REQUIRE(sig(2));
+    REQUIRE(tried == std::vector<int>{1, 2});
+    tried.clear();
+    REQUIRE(!sig(3));
+    REQUIRE(tried == std::vector<int>{1, 2});
+}
+
+TEST_CASE("Filter_signal skips expired Slots and disconnects by id",
+          "[Filter_signal]")
+{
+    auto sig       = sl::Filter_signal<bool()>{};
+    auto const id1 = sig.connect([] { return false; });
+    {
+        auto life = sl::Lifetime{};
+        sig.connect(sl::Slot<bool()>{[] { return true; }}.track(life));
+        REQUIRE(sig());
+    }
+    REQUIRE(!sig());
+    auto const id3 = sig.connect([] { return true; });
+    REQUIRE(id3 != id1);
+    REQUIRE(sig());
+    sig.disconnect(id3);
+    REQUIRE(!sig());
+    REQUIRE(sig.slot_count() == 2);
+    REQUIRE_THROWS_AS(sig.disconnect(id3), std::invalid_argument);
+    REQUIRE_THROWS_AS((sl::Filter_signal<bool()>{sl::Slot_order::Adaptive, 0}),
+                      std::invalid_argument);
+}
+
+TEST_CASE("Adaptive Filter_signal tries frequent handlers first",
+          "[Filter_signal]")
+{
+    auto sig  = sl::Filter_signal<bool(int)>{sl::Slot_order::Adaptive, 16};
+    auto cold = 0;
+    auto hot  = 0;
+    for (auto i = 0; i < 4; ++i) {
+        sig.connect([&cold, i](int x) {
+            ++cold;
+            return x == i;
+        });
+    }
+    auto const hot_id = sig.connect([&hot](int x) {
+        ++hot;
+        return x == 99;
+    });
+
+    for (auto i = 0; i < 16; ++i)
+        sig(99);
+    REQUIRE(cold == 4 * 15);
+    cold = 0;
+    for (auto i = 0; i < 10; ++i)
+        REQUIRE(sig(99));
+    REQUIRE(cold == 0);
+
+    // Cold handlers still work, and identifiers survive reordering.
+    REQUIRE(sig(2));
+    sig.disconnect(hot_id);
+    REQUIRE(!sig(99));
+}
+
+TEST_CASE("Adaptive Filter_signal defers reordering during a reentrant emit",
+          "[Filter_signal]")
+{
+    auto sig   = sl::Filter_signal<bool(int)>{sl::Slot_order::Adaptive, 4};
+    auto calls = 0;
+    sig.connect([&](int x) {
+        ++calls;
+        if (x == 0)
+            REQUIRE(sig(1));
+        return false;
+    });
+    sig.connect([](int x) { return x == 1; });
+    sig.connect([](int x) { return x != 1; });
+
+    REQUIRE(sig(2));
+    REQUIRE(sig(2));
+    REQUIRE(calls == 2);
+
+    // The nested emit is the fourth, the outer loop keeps its order.
+    REQUIRE(sig(0));
+    REQUIRE(calls == 4);
+
+    // The next outermost emit reorders, most frequent handler first.
+    REQUIRE(sig(2));
+    REQUIRE(calls == 4);
+}
@@ -0,0 +1,108 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/memoizing_signal.hpp>
+
+TEST_CASE("Memoizing_signal answers repeated arguments from the cache",
+          "[Memoizing_signal]")
+{
+    auto measure = sl::Memoizing_signal<int(std::string const&, int)>{};
+    auto calls   = 0;
+    measure.connect([&](std::string const& s, int scale) {
+        ++calls;
+        return static_cast<int>(s.size()) * scale;
+    });
+
+    REQUIRE(*measure("abc", 2) == 6);
+    REQUIRE(*measure("abc", 2) == 6);
+    REQUIRE(*measure("abc", 3) == 9);
+    REQUIRE(*measure("abc", 2) == 6);
+    REQUIRE(calls == 2);
+    REQUIRE(measure.hit_count() == 2);
+    REQUIRE(measure.miss_count() == 2);
+    REQUIRE(measure.cache_size() == 2);
+}
+
+TEST_CASE("Memoizing_signal evicts the least recently used result",
+          "[Memoizing_signal]")
+{
+    auto sig   = sl::Memoizing_signal<int(int)>{2};
+    auto calls = 0;
+    sig.connect([&](int x) {
+        ++calls;
+        return x * x;
+    });
+    sig(1);
+    sig(2);
+    sig(1);  // 2 is now the least recently used.
+    sig(3);
+    REQUIRE(sig.cache_size() == 2);
+    REQUIRE(calls == 3);
+    sig(1);
+    REQUIRE(calls == 3);
+    sig(2);
+    REQUIRE(calls == 4);
+    REQUIRE_THROWS_AS(sl::Memoizing_signal<int(int)>{0},
+                      std::invalid_argument);
+}
+
+TEST_CASE("Memoizing_signal cache is cleared by connect, disconnect and expiry",
+          "[Memoizing_signal]")
+{
+    auto sig = sl::Memoizing_signal<int(int)>{};
+    REQUIRE(sig(1) == std::nullopt);
+
+    auto const id = sig.connect([](int x) { return x + 1; });
+    REQUIRE(*sig(1) == 2);
+    {
+        auto life = sl::Lifetime{};
+        auto slot = sl::Slot<int(int)>{[](int x) { return x + 2; }};
+        sig.connect(slot.track(life));
+        REQUIRE(*sig(1) == 3);
+        REQUIRE(*sig(1) == 3);
+    }
+    REQUIRE(sig.expired_slot_count() == 1);
+    REQUIRE(*sig(1) == 2);
+
+    sig.disconnect(id);
+    REQUIRE(sig.cache_size() == 0);
+    REQUIRE(sig(1) == std::nullopt);
+}
+
+TEST_CASE("Memoizing_signal does not cache while a Slot is tracked",
+          "[Memoizing_signal]")
+{
+    auto sig   = sl::Memoizing_signal<int(int)>{};
+    auto calls = 0;
+    sig.connect([&calls](int x) {
+        ++calls;
+        return x;
+    });
+    auto lives = std::vector<sl::Lifetime>(2);
+    sig.connect(sl::Slot<int(int)>{[](int x) { return x + 10; }}.track(
+        lives[0]));
+    REQUIRE(*sig(1) == 11);
+    REQUIRE(*sig(1) == 11);
+    REQUIRE(calls == 2);
+    REQUIRE(sig.cache_size() == 0);
+
+    // Same expired count before and after, different live Slots.
+    lives.erase(std::begin(lives));
+    REQUIRE(sig.purge_expired() == 1);
+    sig.connect(sl::Slot<int(int)>{[](int x) { return x + 20; }}.track(
+        lives[0]));
+    REQUIRE(*sig(1) == 21);
+    lives.clear();
+    REQUIRE(*sig(1) == 1);
+
+    REQUIRE(sig.purge_expired() == 1);
+    REQUIRE(*sig(2) == 2);
+    REQUIRE(*sig(2) == 2);
+    REQUIRE(sig.hit_count() == 1);
+
+    sig.disconnect_all();
+    REQUIRE(sig(2) == std::nullopt);
+}
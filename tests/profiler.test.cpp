@@ -0,0 +1,88 @@
+#include <sstream>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/profiler.hpp>
+
+TEST_CASE("Profiler records nothing while disabled", "[Profiler]")
+{
+    auto profiler = sl::Profiler{};
+    auto sig      = sl::Profiled_signal<int()>{"sig", profiler};
+    sig.connect([] { return 5; });
+    REQUIRE(*sig() == 5);
+
+    auto const nodes = profiler.nodes();
+    REQUIRE(nodes.size() == 1);
+    REQUIRE(nodes[0].name == "sig");
+    REQUIRE(nodes[0].emit_count == 0);
+}
+
+TEST_CASE("Profiler builds the emission graph of cascades", "[Profiler]")
+{
+    auto profiler = sl::Profiler{};
+    auto resize   = sl::Profiled_signal<void(int)>{"resize", profiler};
+    auto layout   = sl::Profiled_signal<void()>{"layout", profiler};
+    auto paint    = sl::Profiled_signal<void()>{"paint", profiler};
+
+    resize.connect([&](int) { layout(); });
+    resize.connect([&](int) { paint(); });
+    layout.connect([&] { paint(); });
+    paint.connect([] {});
+
+    profiler.enable();
+    resize(1);
+    resize(2);
+    paint();
+    profiler.disable();
+    resize(3);
+
+    auto const nodes = profiler.nodes();
+    REQUIRE(nodes[resize.node_id()].emit_count == 2);
+    REQUIRE(nodes[resize.node_id()].slot_count == 2);
+    REQUIRE(nodes[layout.node_id()].emit_count == 2);
+    REQUIRE(nodes[paint.node_id()].emit_count == 5);
+    REQUIRE(nodes[resize.node_id()].inclusive_time >=
+            nodes[layout.node_id()].inclusive_time);
+
+    auto const edges = profiler.edges();
+    REQUIRE(edges.size() == 3);
+    for (auto const& e : edges) {
+        if (e.from == resize.node_id())
+            REQUIRE(e.count == 2);
+        if (e.from == layout.node_id()) {
+            REQUIRE(e.to == paint.node_id());
+            REQUIRE(e.count == 2);
+        }
+    }
+
+    auto const cascades = profiler.top_cascades(1);
+    REQUIRE(cascades.size() == 1);
+    REQUIRE(cascades[0].root == resize.node_id());
+    REQUIRE(cascades[0].count == 2);
+    REQUIRE(cascades[0].nested_emits == 6);
+    REQUIRE(profiler.top_cascades(10).size() == 2);
+
+    SECTION("Exports as DOT and JSON")
+    {
+        auto dot = std::ostringstream{};
+        profiler.write_dot(dot, 1);
+        REQUIRE(dot.str().find("digraph") == 0);
+        REQUIRE(dot.str().find("\"resize\\nslots: 2") != std::string::npos);
+        REQUIRE(dot.str().find("n1 -> n2") != std::string::npos);
+
+        auto json = std::ostringstream{};
+        profiler.write_json(json, 1);
+        REQUIRE(json.str().find("\"top_cascades\":[{\"root\":0,\"count\":2") !=
+                std::string::npos);
+    }
+
+    SECTION("reset() clears the counts but keeps the nodes")
+    {
+        profiler.reset();
+        REQUIRE(profiler.nodes().size() == 3);
+        REQUIRE(profiler.nodes()[0].emit_count == 0);
+        REQUIRE(profiler.edges().empty());
+        REQUIRE(profiler.top_cascades(5).empty());
+    }
+}
@@ -0,0 +1,178 @@
+#include <cerrno>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/reactor.hpp>
+
+namespace {
+
+/// Non-blocking pipe, closed on destruction.
+struct Pipe {
+    int read_end;
+    int write_end;
+
+    Pipe()
+    {
+        int fds[2];
+        REQUIRE(::pipe2(fds, O_NONBLOCK | O_CLOEXEC) == 0);
+        read_end  = fds[0];
+        write_end = fds[1];
+    }
+
+    ~Pipe()
+    {
+        ::close(read_end);
+        ::close(write_end);
+    }
+};
+
+/// Read everything available on \p fd, as required with edge triggering.
+auto drain(int fd) -> std::string
+{
+    auto result = std::string{};
+    char buffer[64];
+    auto n = ::read(fd, buffer, sizeof(buffer));
+    while (n > 0) {
+        result.append(buffer, static_cast<std::size_t>(n));
+        n = ::read(fd, buffer, sizeof(buffer));
+    }
+    REQUIRE(errno == EAGAIN);
+    return result;
+}
+
+}  // namespace
+
+TEST_CASE("Fd_signal emits when a pipe becomes readable", "[Reactor]")
+{
+    auto reactor  = sl::Reactor{};
+    auto pipe     = Pipe{};
+    auto readable = sl::Fd_signal{reactor, pipe.read_end};
+    auto received = std::string{};
+    readable.connect([&](sl::Fd_events ev) {
+        REQUIRE(sl::has(ev, sl::Fd_events::Readable));
+        received += drain(pipe.read_end);
+    });
+
+    REQUIRE(reactor.run_once(0) == 0);
+    REQUIRE(::write(pipe.write_end, "abc", 3) == 3);
+    REQUIRE(::write(pipe.write_end, "def", 3) == 3);
+    REQUIRE(reactor.run_once(1'000) == 1);
+    REQUIRE(received == "abcdef");
+
+    // Edge triggered, no new data means no new emission.
+    REQUIRE(reactor.run_once(0) == 0);
+}
+
+TEST_CASE("Fd_signal reports writable and hangup events", "[Reactor]")
+{
+    auto reactor = sl::Reactor{};
+    auto pipe    = std::make_unique<Pipe>();
+    auto events  = sl::Fd_events::None;
+    auto writable =
+        sl::Fd_signal{reactor, pipe->write_end, sl::Fd_events::Writable};
+    writable.connect([&events](sl::Fd_events ev) { events = ev; });
+
+    REQUIRE(reactor.run_once(1'000) == 1);
+    REQUIRE(sl::has(events, sl::Fd_events::Writable));
+
+    ::close(pipe->read_end);
+    pipe->read_end = ::open("/dev/null", O_RDONLY | O_CLOEXEC);
+    REQUIRE(reactor.run_once(1'000) == 1);
+    REQUIRE(sl::has(events, sl::Fd_events::Error));
+}
+
+TEST_CASE("Fd_signal dispatches timerfd expirations", "[Reactor]")
+{
+    auto reactor = sl::Reactor{};
+    auto const timer =
+        ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    REQUIRE(timer != -1);
+
+    auto spec                = ::itimerspec{};
+    spec.it_value.tv_nsec    = 1'000'000;
+    spec.it_interval.tv_nsec = 1'000'000;
+    REQUIRE(::timerfd_settime(timer, 0, &spec, nullptr) == 0);
+
+    auto ticks        = std::uint64_t{0};
+    auto timer_signal = sl::Fd_signal{reactor, timer};
+    timer_signal.connect([&ticks, timer](sl::Fd_events) {
+        auto expirations = std::uint64_t{0};
+        while (::read(timer, &expirations, sizeof(expirations)) > 0)
+            ticks += expirations;
+    });
+
+    while (ticks < 5)
+        reactor.run_once(1'000);
+    ::close(timer);
+    REQUIRE(ticks >= 5);
+}
+
+TEST_CASE("Fd_signals can be destroyed from within a batch", "[Reactor]")
+{
+    auto reactor = sl::Reactor{};
+    auto pipe_1  = Pipe{};
+    auto pipe_2  = Pipe{};
+    auto first   = std::make_unique<sl::Fd_signal>(reactor, pipe_1.read_end);
+    auto second  = std::make_unique<sl::Fd_signal>(reactor, pipe_2.read_end);
+
+    // Whichever is dispatched first destroys the other, still pending one.
+    auto calls = 0;
+    first->connect([&](sl::Fd_events) {
+        ++calls;
+        second.reset();
+    });
+    second->connect([&](sl::Fd_events) {
+        ++calls;
+        first.reset();
+    });
+
+    REQUIRE(::write(pipe_1.write_end, "x", 1) == 1);
+    REQUIRE(::write(pipe_2.write_end, "x", 1) == 1);
+    REQUIRE(reactor.run_once(1'000) == 1);
+    REQUIRE(calls == 1);
+}
+
+TEST_CASE("Events after a throwing Slot are kept for the next run",
+          "[Reactor]")
+{
+    auto reactor = sl::Reactor{};
+    auto pipe_1  = Pipe{};
+    auto pipe_2  = Pipe{};
+    auto first   = sl::Fd_signal{reactor, pipe_1.read_end};
+    auto second  = sl::Fd_signal{reactor, pipe_2.read_end};
+
+    // Whichever is dispatched first throws, once.
+    auto thrown   = false;
+    auto received = std::string{};
+    auto const slot = [&](int fd) {
+        return [&, fd](sl::Fd_events) {
+            received += drain(fd);
+            if (!thrown) {
+                thrown = true;
+                throw std::runtime_error{"slot"};
+            }
+        };
+    };
+    first.connect(slot(pipe_1.read_end));
+    second.connect(slot(pipe_2.read_end));
+
+    REQUIRE(::write(pipe_1.write_end, "a", 1) == 1);
+    REQUIRE(::write(pipe_2.write_end, "b", 1) == 1);
+    REQUIRE_THROWS_AS(reactor.run_once(1'000), std::runtime_error);
+    REQUIRE(received.size() == 1);
+    REQUIRE(reactor.has_kept_events());
+
+    // Not reported by epoll again, only delivered because it was kept.
+    REQUIRE(reactor.run_once(-1) == 1);
+    REQUIRE(!reactor.has_kept_events());
+    REQUIRE(received.size() == 2);
+    REQUIRE(reactor.run_once(0) == 0);
+}
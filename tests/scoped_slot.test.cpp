@@ -0,0 +1,131 @@
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/scoped_slot.hpp>
+#include <signals_light/signal.hpp>
+
+TEST_CASE("Function_ref references its callable", "[Scoped_slot]")
+{
+    using Ref_t = sl::Function_ref<int(int)>;
+    REQUIRE(std::is_trivially_copyable_v<Ref_t>);
+    REQUIRE(sizeof(Ref_t) == 2 * sizeof(void*));
+    REQUIRE(!std::is_constructible_v<Ref_t, int (*&&)(int)>);
+
+    auto total = 0;
+    auto add   = [&total](int x) { return total += x; };
+    auto ref   = Ref_t{add};
+    auto copy  = ref;
+    REQUIRE(ref(2) == 2);
+    REQUIRE(copy(3) == 5);
+
+    auto counter = [n = 0](int x) mutable { return n += x; };
+    auto mutable_ref = Ref_t{counter};
+    mutable_ref(4);
+    REQUIRE(counter(0) == 4);
+
+    auto const values = std::vector<int>{1, 2};
+    auto sum = [](int const& x, std::vector<int> const& v) {
+        return x + v.back();
+    };
+    auto const sum_ref = sl::Function_ref<int(int const&,
+                                              std::vector<int> const&)>{sum};
+    REQUIRE(sum_ref(1, values) == 3);
+}
+
+TEST_CASE("Scoped_slot connects for the lifetime of the guard",
+          "[Scoped_slot]")
+{
+    auto sig       = sl::Signal<void(int, int)>{};
+    auto collected = std::vector<int>{};
+    auto collect   = [&collected](int w, int h) {
+        collected.push_back(w * h);
+    };
+
+    sig(1, 1);
+    {
+        auto const guard = sl::Scoped_slot{sig, collect};
+        REQUIRE(sig.slot_count() == 1);
+        sig(2, 3);
+        sig(4, 5);
+    }
+    sig(6, 7);
+    REQUIRE(sig.is_empty());
+    REQUIRE(collected == std::vector<int>{6, 20});
+}
+
+TEST_CASE("Scoped_slot stores the callable inline", "[Scoped_slot]")
+{
+    auto sig     = sl::Signal<void()>{};
+    auto calls   = 0;
+    auto counter = [&calls] { ++calls; };
+    auto const guard = sl::Scoped_slot{sig, counter};
+
+    SECTION("Not copied into the std::function")
+    {
+        auto const slot    = sig.disconnect(guard.id());
+        auto const& f      = slot.slot_function();
+        auto const* target = f.target<sl::Function_ref<void()>>();
+        REQUIRE(target != nullptr);
+#if defined(__GLIBCXX__)
+        auto const* begin = reinterpret_cast<char const*>(&f);
+        auto const* p     = reinterpret_cast<char const*>(target);
+        REQUIRE((p >= begin && p < begin + sizeof(f)));
+#endif
+        f();
+        REQUIRE(calls == 1);
+    }
+
+    SECTION("An early disconnect is tolerated by the guard")
+    {
+        sig.disconnect(guard.id());
+        REQUIRE(sig.is_empty());
+    }
+}
+
+TEST_CASE("Scoped_slot leaves a later Slot alone after an early disconnect",
+          "[Scoped_slot]")
+{
+    auto sig    = sl::Signal<void()>{};
+    auto hits   = 0;
+    auto ignore = [] {};
+    {
+        auto const guard = sl::Scoped_slot{sig, ignore};
+        sig.disconnect(guard.id());
+        sig.connect([&hits] { ++hits; });
+    }
+    REQUIRE(sig.slot_count() == 1);
+    sig();
+    REQUIRE(hits == 1);
+}
+
+TEST_CASE("Scoped_slot connects to any Storage policy", "[Scoped_slot]")
+{
+    auto sig   = sl::Signal<int(int), sl::Small_storage<2>>{};
+    auto twice = [](int x) { return 2 * x; };
+    {
+        auto const guard = sl::Scoped_slot{sig, twice};
+        REQUIRE(std::is_same_v<decltype(guard),
+                               sl::Scoped_slot<decltype(sig)> const>);
+        REQUIRE(sig(4) == 8);
+    }
+    REQUIRE(sig.is_empty());
+}
+
+TEST_CASE("Scoped_slot reuses the Signal's capacity", "[Scoped_slot]")
+{
+    auto sig   = sl::Signal<int()>{};
+    auto value = [] { return 7; };
+    sig.connect([] { return 1; });
+    auto usage = std::vector<std::size_t>{};
+    for (auto i = 0; i < 3; ++i) {
+        auto const guard = sl::Scoped_slot{sig, value};
+        REQUIRE(sig() == 7);
+        usage.push_back(sig.memory_usage());
+    }
+    REQUIRE(usage[0] == usage[1]);
+    REQUIRE(usage[1] == usage[2]);
+    REQUIRE(sig() == 1);
+}
@@ -0,0 +1,132 @@
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/scratch.hpp>
+#include <signals_light/signal.hpp>
+
+namespace {
+
+auto is_aligned(void const* p, std::size_t alignment) -> bool
+{
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+}  // namespace
+
+TEST_CASE("Scratch_arena", "[Scratch_arena]")
+{
+    REQUIRE_THROWS_AS(sl::Scratch_arena{0}, std::invalid_argument);
+
+    auto arena = sl::Scratch_arena{64};
+    REQUIRE(arena.capacity() == 0);
+
+    SECTION("Allocations are aligned and distinct")
+    {
+        auto* const c = arena.make<char>('x');
+        auto* const d = arena.make<double>(1.5);
+        auto* const a = arena.make_array<std::uint32_t>(5);
+        REQUIRE(*c == 'x');
+        REQUIRE(*d == 1.5);
+        REQUIRE(is_aligned(d, alignof(double)));
+        REQUIRE(is_aligned(a, alignof(std::uint32_t)));
+        REQUIRE(is_aligned(arena.allocate(1, 64), 64));
+        REQUIRE(arena.bytes_used() == 1 + sizeof(double) + 20 + 1);
+    }
+
+    SECTION("Reset reuses a single block")
+    {
+        auto* const first = arena.allocate(16);
+        arena.reset();
+        REQUIRE(arena.bytes_used() == 0);
+        REQUIRE(arena.allocate(16) == first);
+        REQUIRE(arena.capacity() == 64);
+    }
+
+    SECTION("Reset merges several blocks into one")
+    {
+        for (auto i = 0; i < 10; ++i)
+            REQUIRE(arena.allocate(48) != nullptr);
+        auto const capacity = arena.capacity();
+        REQUIRE(capacity >= 480);
+        arena.reset();
+        REQUIRE(arena.capacity() == 0);
+        for (auto i = 0; i < 10; ++i)
+            REQUIRE(arena.allocate(48) != nullptr);
+        REQUIRE(arena.capacity() == capacity);
+    }
+
+    SECTION("Backs std::pmr containers")
+    {
+        auto text = std::pmr::string{&arena};
+        text.append(200, 'a');
+        REQUIRE(text.size() == 200);
+        REQUIRE(arena.bytes_used() > 200);
+    }
+}
+
+TEST_CASE("Emission_context scratch arena", "[Scratch_arena]")
+{
+    REQUIRE(!sl::Emission_context::is_emitting());
+
+    auto sig      = sl::Signal<int(int)>{};
+    auto inner    = sl::Signal<void()>{};
+    auto depths   = std::vector<int>{};
+    auto buffers  = std::vector<void*>{};
+    auto used     = std::size_t{0};
+    auto in_inner = std::size_t{0};
+    inner.connect([&] {
+        depths.push_back(sl::Emission_context::depth());
+        auto* const p = sl::Emission_context::scratch().allocate(100);
+        REQUIRE(p != nullptr);
+        in_inner = sl::Emission_context::scratch().bytes_used();
+    });
+    sig.connect([&](int x) {
+        depths.push_back(sl::Emission_context::depth());
+        auto& scratch = sl::Emission_context::scratch();
+        auto text     = std::pmr::string{&scratch};
+        text.append(static_cast<std::size_t>(x), 'x');
+        buffers.push_back(text.data());
+        inner();
+        used = scratch.bytes_used();
+        return static_cast<int>(text.size());
+    });
+
+    REQUIRE(sig(500) == 500);
+    REQUIRE(depths == std::vector<int>{1, 2});
+    REQUIRE(in_inner > 500);
+    REQUIRE(used == in_inner);
+    REQUIRE(!sl::Emission_context::is_emitting());
+    REQUIRE(sl::Emission_context::scratch().bytes_used() == 0);
+
+    SECTION("The outermost emission resets, steady state reuses memory")
+    {
+        sig(500);
+        sig(500);
+        REQUIRE(buffers.size() == 3);
+        REQUIRE(buffers[1] == buffers[2]);
+    }
+
+    SECTION("An exception from a Slot still resets the arena")
+    {
+        sig.connect([](int) -> int {
+            (void)sl::Emission_context::scratch().allocate(10);
+            throw std::runtime_error{"slot"};
+        });
+        REQUIRE_THROWS_AS(sig(1), std::runtime_error);
+        REQUIRE(!sl::Emission_context::is_emitting());
+        REQUIRE(sl::Emission_context::scratch().bytes_used() == 0);
+    }
+
+    SECTION("Incremental emissions reset after each slice")
+    {
+        auto cursor = sig.emit_incremental(10);
+        REQUIRE(cursor.advance(1));
+        REQUIRE(sl::Emission_context::scratch().bytes_used() == 0);
+    }
+}
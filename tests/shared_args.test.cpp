@@ -0,0 +1,143 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/event_queue.hpp>
+#include <signals_light/shared_args.hpp>
+#include <signals_light/signal.hpp>
+
+namespace {
+
+/// Counts the number of times it has been copied.
+struct Payload {
+    inline static int copies = 0;
+
+    std::vector<int> data;
+
+    explicit Payload(std::vector<int> d) : data{std::move(d)} {}
+    Payload(Payload const& x) : data{x.data} { ++copies; }
+    Payload(Payload&&) = default;
+};
+
+}  // namespace
+
+TEST_CASE("Shared_args shares one copy of the arguments", "[Shared_args]")
+{
+    auto const text = std::string{"hello"};
+    auto a          = sl::Shared_args<int, std::string const&>::make(5, text);
+    REQUIRE(a.use_count() == 1);
+    {
+        auto b = a;
+        REQUIRE(a.use_count() == 2);
+        REQUIRE(&a.get() == &b.get());
+        auto const c = std::move(b);
+        REQUIRE(a.use_count() == 2);
+        REQUIRE(b.use_count() == 0);
+    }
+    REQUIRE(a.use_count() == 1);
+    REQUIRE(std::get<0>(a.get()) == 5);
+    REQUIRE(std::get<1>(a.get()) == "hello");
+    REQUIRE(a.apply([](int i, std::string const& s) {
+        return s + std::to_string(i);
+    }) == "hello5");
+}
+
+TEST_CASE("Queued_slots copy the arguments once per emission", "[Shared_args]")
+{
+    auto queue_1 = sl::Event_queue{};
+    auto queue_2 = sl::Event_queue{};
+    auto sums    = std::vector<int>{};
+    auto sum     = [&sums](Payload const& p) {
+        auto total = 0;
+        for (auto x : p.data)
+            total += x;
+        sums.push_back(total);
+    };
+
+    auto targets = sl::Queued_slots<void(Payload const&)>{};
+    targets.add(queue_1, sl::Slot<void(Payload const&)>{sum})
+        .add(queue_1, sl::Slot<void(Payload const&)>{sum})
+        .add(queue_2, sl::Slot<void(Payload const&)>{sum});
+    REQUIRE(targets.size() == 3);
+
+    auto sig = sl::Signal<void(Payload const&)>{};
+    sig.connect(targets.slot());
+
+    Payload::copies = 0;
+    sig(Payload{{1, 2, 3}});
+    sig(Payload{{4, 5, 6}});
+    REQUIRE(Payload::copies == 2);
+
+    REQUIRE(queue_1.process_events() == 4);
+    REQUIRE(queue_2.process_events() == 2);
+    REQUIRE(sums == std::vector<int>{6, 6, 15, 15, 6, 15});
+}
+
+TEST_CASE("Queued_slots copy by value arguments once per target",
+          "[Shared_args]")
+{
+    auto queue   = sl::Event_queue{};
+    auto sizes   = std::vector<std::size_t>{};
+    auto size    = [&sizes](Payload p) { sizes.push_back(p.data.size()); };
+    auto targets = sl::Queued_slots<void(Payload)>{};
+    for (auto i = 0; i < 3; ++i)
+        targets.add(queue, sl::Slot<void(Payload)>{size});
+    auto sig = sl::Signal<void(Payload)>{};
+    sig.connect(targets.slot());
+
+    auto const payload = Payload{{1, 2}};
+    Payload::copies    = 0;
+    sig(payload);
+    REQUIRE(Payload::copies == 1);
+
+    // Each target's parameter is its own copy of the shared one.
+    REQUIRE(queue.process_events() == 3);
+    REQUIRE(Payload::copies == 1 + 3);
+    REQUIRE(sizes == std::vector<std::size_t>{2, 2, 2});
+}
+
+TEST_CASE("Queued_slots skip expired targets", "[Shared_args]")
+{
+    auto queue   = sl::Event_queue{};
+    auto calls   = 0;
+    auto sig     = sl::Signal<void(int)>{};
+    auto targets = sl::Queued_slots<void(int)>{};
+    {
+        auto life = sl::Lifetime{};
+        auto slot = sl::Slot<void(int)>{[&calls](int) { ++calls; }};
+        slot.track(life);
+        targets.add(queue, slot);
+        targets.add(queue, sl::Slot<void(int)>{[&calls](int) { ++calls; }});
+        sig.connect(targets.slot());
+        sig(1);
+    }
+    REQUIRE(queue.process_events() == 2);
+    REQUIRE(calls == 1);
+}
+
+TEST_CASE("Shared_args can be released on other threads", "[Shared_args]")
+{
+    auto queue    = sl::Event_queue{};
+    auto received = std::size_t{0};
+    auto targets  = sl::Queued_slots<void(std::string const&)>{};
+    for (auto i = 0; i < 4; ++i) {
+        targets.add(queue, sl::Slot<void(std::string const&)>{
+                               [&received](std::string const& s) {
+                                   received += s.size();
+                               }});
+    }
+    auto sig = sl::Signal<void(std::string const&)>{};
+    sig.connect(targets.slot());
+
+    auto constexpr count = 500;
+    auto producer        = std::thread{[&sig] {
+        for (auto i = 0; i < count; ++i)
+            sig(std::string(100, 'x'));
+    }};
+    while (received < count * 4 * 100)
+        queue.process_events();
+    producer.join();
+    REQUIRE(received == count * 4 * 100);
+}
@@ -0,0 +1,160 @@
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/shm_signal.hpp>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+struct Point {
+    int x;
+    int y;
+};
+
+/// Fork \p child and return its pid once it signals ready on \p ready_fd.
+template <typename F>
+auto fork_and_wait(F&& child, int ready_fd) -> int
+{
+    auto const pid = ::fork();
+    if (pid == 0)
+        ::_exit(child());
+    char c;
+    REQUIRE(::read(ready_fd, &c, 1) == 1);
+    return pid;
+}
+
+}  // namespace
+
+TEST_CASE("Shm_receiver re-emits values in the same process", "[Shm_signal]")
+{
+    auto producer = sl::Shm_signal<Point>{8};
+    REQUIRE(producer.capacity() == 8);
+    auto receiver = sl::Shm_receiver<Point>{producer.fd()};
+    auto received = std::vector<int>{};
+    receiver.connect([&received](Point const& p) {
+        received.push_back(p.x + p.y);
+    });
+
+    REQUIRE(receiver.poll() == 0);
+    producer({1, 2});
+    producer({3, 4});
+    REQUIRE(receiver.poll() == 2);
+    REQUIRE(received == std::vector<int>{3, 7});
+    REQUIRE(receiver.wait(1ms) == 0);
+
+    SECTION("Falling behind by more than the capacity loses the oldest")
+    {
+        for (auto i = 0; i < 20; ++i)
+            producer({i, 0});
+        REQUIRE(receiver.poll() == 8);
+        REQUIRE(receiver.overruns() == 12);
+        REQUIRE(received.back() == 19);
+    }
+}
+
+TEST_CASE("Shm_receiver rejects segments of another size", "[Shm_signal]")
+{
+    auto producer = sl::Shm_signal<std::uint64_t>{4};
+    REQUIRE_THROWS_AS(sl::Shm_receiver<std::uint32_t>{producer.fd()},
+                      std::invalid_argument);
+    REQUIRE_THROWS_AS(sl::Shm_signal<int>{0}, std::invalid_argument);
+}
+
+TEST_CASE("Shm_signal delivers to a forked receiver process", "[Shm_signal]")
+{
+    auto constexpr count = std::uint64_t{100'000};
+    auto producer        = sl::Shm_signal<std::uint64_t>{1'024};
+    int ready[2];
+    REQUIRE(::pipe(ready) == 0);
+
+    auto const pid = fork_and_wait(
+        [&] {
+            auto receiver = sl::Shm_receiver<std::uint64_t>{producer.fd()};
+            auto received = std::uint64_t{0};
+            auto last     = std::uint64_t{0};
+            auto ordered  = true;
+            receiver.connect([&](std::uint64_t x) {
+                ordered = ordered && (received == 0 || x > last);
+                last    = x;
+                ++received;
+            });
+            [[maybe_unused]] auto const r = ::write(ready[1], "r", 1);
+            while (last != count - 1) {
+                if (receiver.wait(5s) == 0)
+                    return 2;
+            }
+            return ordered && received + receiver.overruns() == count ? 0 : 1;
+        },
+        ready[0]);
+
+    for (auto i = std::uint64_t{0}; i < count; ++i)
+        producer(i);
+
+    auto status = 0;
+    REQUIRE(::waitpid(pid, &status, 0) == pid);
+    ::close(ready[0]);
+    ::close(ready[1]);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+}
+
+TEST_CASE("Named Shm_signal segments wake sleeping receivers",
+          "[Shm_signal]")
+{
+    auto const name = "/signals_light_test_" + std::to_string(::getpid());
+    auto producer   = sl::Shm_signal<Point>{name, 16};
+    REQUIRE(producer.name() == name);
+    int ready[2];
+    REQUIRE(::pipe(ready) == 0);
+
+    auto const pid = fork_and_wait(
+        [&] {
+            auto receiver = sl::Shm_receiver<Point>{name};
+            auto sum      = 0;
+            auto received = 0;
+            receiver.connect([&](Point const& p) {
+                sum += p.x * p.y;
+                ++received;
+            });
+            [[maybe_unused]] auto const r = ::write(ready[1], "r", 1);
+            // Emissions close together can arrive in a single wake-up.
+            while (received < 3) {
+                if (receiver.wait(5s) == 0)
+                    return 2;
+            }
+            return sum == 2 + 12 + 30 ? 0 : 1;
+        },
+        ready[0]);
+
+    // Spaced out so the receiver is asleep in wait() for each emission.
+    for (auto i = 1; i <= 5; i += 2) {
+        ::usleep(20'000);
+        producer({i, i + 1});
+    }
+
+    auto status = 0;
+    REQUIRE(::waitpid(pid, &status, 0) == pid);
+    ::close(ready[0]);
+    ::close(ready[1]);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+}
+
+TEST_CASE("A failed named Shm_signal doesn't leave its segment behind",
+          "[Shm_signal]")
+{
+    auto const name = "/signals_light_fail_" + std::to_string(::getpid());
+    REQUIRE_THROWS_AS((sl::Shm_signal<Point>{name, 0}),
+                      std::invalid_argument);
+    auto producer = sl::Shm_signal<Point>{name, 4};
+    REQUIRE(producer.name() == name);
+}
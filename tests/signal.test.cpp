@@ -1,11 +1,39 @@
+#include <array>
+#include <chrono>
 #include <optional>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 
 #include <signals_light/signal.hpp>
 
+namespace {
+
+struct Point {
+    double x;
+    double y;
+};
+
+/// Small enough to copy, but not opted in.
+struct Handle {
+    int value;
+};
+
+/// Takes itself, incomplete where its Signal member is instantiated.
+struct Widget {
+    sl::Signal<void(Widget const&)> changed;
+    sl::Signal<void(Widget&, int)> resized;
+    int width = 0;
+};
+
+}  // namespace
+
+template <>
+struct sl::is_passed_by_value<Point> : std::true_type {};
+
 TEST_CASE("Signal with no Slots", "[Signal]")
 {
     SECTION("void Signal return type will return void")
@@ -198,3 +226,305 @@ TEST_CASE("Lifetime Tracking", "[Signal]")
         REQUIRE(*sig() == 5);
     }
 }
+
+TEST_CASE("Memory usage introspection", "[Signal]")
+{
+    SECTION("Slot counts tracked objects and heap stored slot functions")
+    {
+        auto small = sl::Slot<void()>{[] {}};
+        REQUIRE(small.memory_usage() == sizeof(small));
+
+        auto life = sl::Lifetime{};
+        small.track(life);
+        REQUIRE(small.memory_usage() >=
+                sizeof(small) + sizeof(sl::Lifetime_observer));
+
+        auto big   = std::array<char, 256>{};
+        auto large = sl::Slot<void()>{[big] { (void)big; }};
+        REQUIRE(large.memory_usage() >= sizeof(large) + sizeof(big));
+    }
+
+    SECTION("Target sizes recorded from several threads at once")
+    {
+        auto const make = [] {
+            auto big = std::array<char, 128>{};
+            return sl::Slot<void()>{[big] { (void)big; }};
+        };
+        auto slots   = std::vector<std::optional<sl::Slot<void()>>>(4);
+        auto threads = std::vector<std::thread>{};
+        for (auto& slot : slots)
+            threads.emplace_back([&slot, &make] { slot.emplace(make()); });
+        for (auto& t : threads)
+            t.join();
+        for (auto const& slot : slots)
+            REQUIRE(slot->memory_usage() >= sizeof(*slot) + 128);
+    }
+
+    SECTION("Signal counts its capacity and every connected Slot")
+    {
+        auto sig = sl::Signal<void()>{};
+        REQUIRE(sig.memory_usage() == sizeof(sig));
+
+        auto big = std::array<char, 256>{};
+        sig.connect([big] { (void)big; });
+        sig.connect([] {});
+        auto const usage = sig.memory_usage();
+        REQUIRE(usage >= sizeof(sig) + 2 * sizeof(sl::Slot<void()>) +
+                             sizeof(big));
+    }
+
+    SECTION("Lifetime control blocks are counted until no longer observed")
+    {
+        auto const before = sl::Lifetime::global_stats();
+        auto sig          = sl::Signal<void()>{};
+        {
+            auto life = sl::Lifetime{};
+            sig.connect(sl::Slot<void()>{[] {}}.track(life));
+            auto const during = sl::Lifetime::global_stats();
+            REQUIRE(during.live == before.live + 1);
+            REQUIRE(during.control_blocks == before.control_blocks + 1);
+            REQUIRE(during.bytes > before.bytes);
+        }
+        auto const expired = sl::Lifetime::global_stats();
+        REQUIRE(expired.live == before.live);
+        REQUIRE(expired.control_blocks == before.control_blocks + 1);
+
+        sig = sl::Signal<void()>{};
+        auto const after = sl::Lifetime::global_stats();
+        REQUIRE(after.control_blocks == before.control_blocks);
+        REQUIRE(after.bytes == before.bytes);
+    }
+}
+
+TEST_CASE("Incremental emission", "[Signal]")
+{
+    auto sig   = sl::Signal<int(int)>{};
+    auto calls = std::vector<int>{};
+    auto ids   = std::vector<sl::Identifier>{};
+    for (auto i = 0; i < 6; ++i) {
+        ids.push_back(sig.connect([&calls, i](int x) {
+            calls.push_back(i);
+            return x + i;
+        }));
+    }
+
+    SECTION("Slot budgets resume where the last slice stopped")
+    {
+        auto cursor = sig.emit_incremental(10);
+        REQUIRE(calls.empty());
+        REQUIRE(cursor.result() == std::nullopt);
+        REQUIRE(!cursor.advance(4));
+        REQUIRE(calls == std::vector<int>{0, 1, 2, 3});
+        REQUIRE(*cursor.result() == 13);
+        REQUIRE(cursor.advance(4));
+        REQUIRE(cursor.is_done());
+        REQUIRE(calls == std::vector<int>{0, 1, 2, 3, 4, 5});
+        REQUIRE(*cursor.result() == 15);
+        REQUIRE(cursor.advance(4));
+        REQUIRE(calls.size() == 6);
+    }
+
+    SECTION("Slots write through non-const reference parameters")
+    {
+        auto counter = sl::Signal<void(int&)>{};
+        for (auto i = 0; i < 3; ++i)
+            counter.connect([](int& total) { ++total; });
+        auto total  = 10;
+        auto cursor = counter.emit_incremental(total);
+        REQUIRE(!cursor.advance(2));
+        REQUIRE(total == 12);
+        REQUIRE(cursor.advance(2));
+        REQUIRE(total == 13);
+    }
+
+    SECTION("Changes between slices are respected")
+    {
+        auto cursor = sig.emit_incremental(0);
+        REQUIRE(!cursor.advance(2));
+        sig.disconnect(ids[1]);  // Already visited.
+        sig.disconnect(ids[3]);  // Not reached yet.
+        {
+            auto life = sl::Lifetime{};
+            sig.disconnect(ids[4]);
+            sig.connect(sl::Slot<int(int)>{[&calls](int x) {
+                            calls.push_back(40);
+                            return x;
+                        }}.track(life));
+        }
+        sig.connect([&calls](int x) {
+            calls.push_back(50);
+            return x;
+        });
+        REQUIRE(!cursor.advance(1));
+        REQUIRE(cursor.advance(10));
+        REQUIRE(calls == std::vector<int>{0, 1, 2, 5, 50});
+    }
+
+    SECTION("Identifiers are not reused after the last Slot disconnects")
+    {
+        auto abc    = sl::Signal<void()>{};
+        auto called = std::vector<char>{};
+        abc.connect([&called] { called.push_back('a'); });
+        auto const b = abc.connect([&called] { called.push_back('b'); });
+        auto const c = abc.connect([&called] { called.push_back('c'); });
+        auto cursor  = abc.emit_incremental();
+        REQUIRE(!cursor.advance(2));
+        abc.disconnect(b);
+        abc.disconnect(c);
+        auto const x = abc.connect([&called] { called.push_back('x'); });
+        REQUIRE(x != b);
+        REQUIRE(x != c);
+        REQUIRE(cursor.advance(10));
+        REQUIRE(called == std::vector<char>{'a', 'b', 'x'});
+    }
+
+    SECTION("Time budgets eventually visit every Slot")
+    {
+        auto void_sig = sl::Signal<void()>{};
+        auto count    = 0;
+        for (auto i = 0; i < 100; ++i)
+            void_sig.connect([&count] { ++count; });
+        auto cursor = void_sig.emit_incremental();
+        while (!cursor.advance_for(std::chrono::microseconds{1})) {}
+        REQUIRE(count == 100);
+    }
+}
+
+TEST_CASE("Relocating Slot storage", "[Signal]")
+{
+#if defined(__GLIBCXX__)
+    REQUIRE(sl::detail::is_trivially_relocatable_v<sl::Lifetime_observer>);
+    REQUIRE(sl::detail::is_trivially_relocatable_v<sl::Slot<int(int)>>);
+#endif
+    REQUIRE(sizeof(sl::Signal<void()>) == 4 * sizeof(void*));
+
+    auto sig   = sl::Signal<int(int)>{};
+    auto lives = std::vector<sl::Lifetime>(50);
+    auto ids   = std::vector<sl::Identifier>{};
+    auto calls = std::vector<int>{};
+    for (auto i = 0; i < 100; ++i) {
+        auto big  = std::array<int, 16>{};
+        auto slot = sl::Slot<int(int)>{[&calls, i, big](int x) {
+            calls.push_back(i + big[0]);
+            return x + i;
+        }};
+        if (i % 2 == 0)
+            slot.track(lives[i / 2]);
+        ids.push_back(sig.connect(std::move(slot)));
+    }
+
+    SECTION("Growth keeps the Slots, their order and their tracking")
+    {
+        REQUIRE(sig.slot_count() == 100);
+        REQUIRE(sig(1) == 100);
+        REQUIRE(calls.size() == 100);
+        REQUIRE(calls[37] == 37);
+        lives.clear();
+        REQUIRE(sig.expired_slot_count() == 50);
+        calls.clear();
+        REQUIRE(sig(0) == 99);
+        REQUIRE(calls.size() == 50);
+        REQUIRE(calls.front() == 1);
+    }
+
+    SECTION("Erasing shifts the remaining Slots down in order")
+    {
+        for (auto i = 0; i < 100; i += 3)
+            sig.disconnect(ids[i]);
+        auto slot = sig.disconnect(ids[50]);
+        REQUIRE(slot(0) == 50);
+        REQUIRE(sig.slot_count() == 65);
+        sig(0);
+        auto expected = std::vector<int>{50};
+        for (auto i = 0; i < 100; ++i) {
+            if (i % 3 != 0 && i != 50)
+                expected.push_back(i);
+        }
+        REQUIRE(calls == expected);
+    }
+
+    SECTION("Copies and moves own their Slots")
+    {
+        auto copy = sig;
+        sig.disconnect(ids[99]);
+        auto moved = std::move(copy);
+        REQUIRE(copy.is_empty());
+        REQUIRE(moved.slot_count() == 100);
+        REQUIRE(moved(0) == 99);
+        copy = moved;
+        REQUIRE(copy.slot_count() == 100);
+        moved = std::move(sig);
+        REQUIRE(moved.slot_count() == 99);
+    }
+}
+
+TEST_CASE("Argument passing", "[Signal]")
+{
+    SECTION("Scalars and opted in classes are copied")
+    {
+        REQUIRE(std::is_same_v<sl::Param_t<int>, int>);
+        REQUIRE(std::is_same_v<sl::Param_t<int const&>, int>);
+        REQUIRE(std::is_same_v<sl::Param_t<Point const&>, Point>);
+        REQUIRE(std::is_same_v<sl::Param_t<Point const>, Point>);
+        REQUIRE(std::is_same_v<sl::Param_t<double const&>, double>);
+        REQUIRE(std::is_same_v<sl::Param_t<Widget*>, Widget*>);
+    }
+
+    SECTION("Other arguments are passed by const reference")
+    {
+        using Large = std::array<int, 16>;
+        REQUIRE(std::is_same_v<sl::Param_t<Large>, Large const&>);
+        REQUIRE(std::is_same_v<sl::Param_t<std::vector<int> const&>,
+                               std::vector<int> const&>);
+        REQUIRE(std::is_same_v<sl::Param_t<Handle const&>, Handle const&>);
+        REQUIRE(std::is_same_v<sl::Param_t<int&>, int&>);
+        REQUIRE(std::is_same_v<sl::Param_t<int&&>, int&>);
+        REQUIRE(std::is_same_v<sl::Param_t<Widget const&>, Widget const&>);
+    }
+
+    SECTION("A Signal can take its own incomplete class")
+    {
+        auto w       = Widget{};
+        auto widths  = std::vector<int>{};
+        auto changed = std::vector<Widget const*>{};
+        w.changed.connect([&](Widget const& x) { changed.push_back(&x); });
+        w.resized.connect([&](Widget& x, int width) {
+            x.width = width;
+            widths.push_back(width);
+        });
+        w.changed(w);
+        w.resized(w, 5);
+        REQUIRE(changed == std::vector<Widget const*>{&w});
+        REQUIRE(w.width == 5);
+        REQUIRE(widths == std::vector<int>{5});
+    }
+
+    SECTION("Copied arguments reach every Slot")
+    {
+        auto sig  = sl::Signal<double(Point const&, int)>{};
+        auto sums = std::vector<double>{};
+        sig.connect([&](Point const& p, int n) { return p.x + p.y + n; });
+        sig.connect([&](Point p, int n) {
+            sums.push_back(p.x * n);
+            return p.y;
+        });
+        REQUIRE(sig(Point{1.5, 2.}, 2) == 2.);
+        REQUIRE(sums == std::vector<double>{3.});
+    }
+
+    SECTION("References bind to the emitted object")
+    {
+        auto const large  = std::array<int, 16>{};
+        auto const handle = Handle{3};
+        auto value        = 0;
+        auto sig = sl::Signal<void(std::array<int, 16> const&,
+                                   Handle const&, int&)>{};
+        sig.connect([&](auto const& l, Handle const& h, int& v) {
+            REQUIRE(&l == &large);
+            REQUIRE(&h == &handle);
+            v = h.value;
+        });
+        sig(large, handle, value);
+        REQUIRE(value == 3);
+    }
+}
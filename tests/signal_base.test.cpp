@@ -0,0 +1,125 @@
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/memoizing_signal.hpp>
+#include <signals_light/signal.hpp>
+#include <signals_light/signal_base.hpp>
+#include <signals_light/unique_signal.hpp>
+
+namespace {
+
+auto answer() -> int { return 42; }
+
+}  // namespace
+
+TEST_CASE("Signal purge_expired and disconnect_all", "[Signal_base]")
+{
+    auto sig   = sl::Signal<int()>{};
+    auto lives = std::vector<sl::Lifetime>(2);
+    sig.connect(sl::Slot<int()>{[] { return 1; }}.track(lives[0]));
+    auto const kept = sig.connect([] { return 2; });
+    sig.connect(sl::Slot<int()>{[] { return 3; }}.track(lives[1]));
+    auto const last = sig.connect([] { return 4; });
+
+    REQUIRE(sig.purge_expired() == 0);
+    lives.clear();
+    REQUIRE(sig.expired_slot_count() == 2);
+    REQUIRE(sig.purge_expired() == 2);
+    REQUIRE(sig.slot_count() == 2);
+    REQUIRE(sig.expired_slot_count() == 0);
+    REQUIRE(sig() == 4);
+    REQUIRE(sig.disconnect(kept).slot_function()() == 2);
+    REQUIRE(sig.disconnect(last).slot_function()() == 4);
+
+    sig.connect([] { return 5; });
+    sig.disconnect_all();
+    REQUIRE(sig.is_empty());
+    REQUIRE(sig() == std::nullopt);
+}
+
+TEST_CASE("Signal_base refers to Signals of any signature", "[Signal_base]")
+{
+    REQUIRE(sizeof(sl::Signal_base) == 2 * sizeof(void*));
+    REQUIRE(sizeof(sl::Signal<void()>) == 4 * sizeof(void*));
+
+    auto clicked = sl::Signal<void()>{};
+    auto resized = sl::Signal<bool(int, int)>{};
+    auto renamed = sl::Signal<void(std::string const&)>{};
+    auto life    = std::make_unique<sl::Lifetime>();
+
+    clicked.connect([] {});
+    resized.connect([](int, int) { return true; });
+    resized.connect(
+        sl::Slot<bool(int, int)>{[](int, int) { return false; }}.track(*life));
+
+    auto const registry =
+        std::vector<sl::Signal_base>{clicked, resized, renamed};
+    REQUIRE(registry[1] == sl::Signal_base{resized});
+    REQUIRE(registry[1] != registry[0]);
+
+    auto total = std::size_t{0};
+    for (auto s : registry)
+        total += s.slot_count();
+    REQUIRE(total == 3);
+    REQUIRE(registry[2].is_empty());
+
+    life.reset();
+    auto const stats = registry[1].stats();
+    REQUIRE(stats.slots == 2);
+    REQUIRE(stats.expired_slots == 1);
+    REQUIRE(stats.bytes == resized.memory_usage());
+
+    auto purged = std::size_t{0};
+    for (auto s : registry)
+        purged += s.purge_expired();
+    REQUIRE(purged == 1);
+    REQUIRE(resized.slot_count() == 1);
+
+    for (auto s : registry)
+        s.disconnect_all();
+    REQUIRE(clicked.is_empty());
+    REQUIRE(resized.is_empty());
+}
+
+TEST_CASE("Signal_base keeps derived Signals consistent", "[Signal_base]")
+{
+    SECTION("Memoizing_signal drops its cache")
+    {
+        auto memo = sl::Memoizing_signal<int(int)>{};
+        memo.connect([](int x) { return x * 2; });
+        REQUIRE(*memo(1) == 2);
+        memo.disconnect_all();
+        REQUIRE(memo(1) == std::nullopt);
+
+        memo.connect([](int x) { return x * 3; });
+        REQUIRE(*memo(1) == 3);
+        sl::Signal_base{memo}.disconnect_all();
+        REQUIRE(memo.cache_size() == 0);
+        REQUIRE(memo(1) == std::nullopt);
+    }
+
+    SECTION("Unique_signal forgets the keys of removed Slots")
+    {
+        auto unique = sl::Unique_signal<int()>{};
+        auto life   = std::make_unique<sl::Lifetime>();
+        auto const tracked_key = sl::Slot_key::user(1);
+        unique.connect_unique(&answer);
+        unique.connect_unique(
+            tracked_key, sl::Slot<int()>{[] { return 1; }}.track(*life));
+
+        life.reset();
+        REQUIRE(sl::Signal_base{unique}.purge_expired() == 1);
+        REQUIRE(!unique.contains(tracked_key));
+        REQUIRE(unique.contains(sl::Slot_key{&answer}));
+
+        sl::Signal_base{unique}.disconnect_all();
+        REQUIRE(!unique.contains(sl::Slot_key{&answer}));
+        REQUIRE(unique.connect_unique(&answer).second);
+        REQUIRE(*unique() == 42);
+    }
+}
@@ -0,0 +1,205 @@
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/signal.hpp>
+#include <signals_light/signal_base.hpp>
+#include <signals_light/slot_storage.hpp>
+
+// Conformance tests, every Storage policy must pass them.
+
+#define SIGNALS_LIGHT_STORAGE_POLICIES                                  \
+    sl::Vector_storage, sl::Small_storage<2>, sl::Fixed_storage<64>, \
+        sl::Slot_map_storage
+
+TEMPLATE_TEST_CASE("Storage connect, emit and disconnect",
+                   "[Slot_storage]",
+                   SIGNALS_LIGHT_STORAGE_POLICIES)
+{
+    using Signal_t = sl::Signal<int(int), TestType>;
+
+    auto sig   = Signal_t{};
+    auto calls = std::vector<int>{};
+    auto ids   = std::vector<sl::Identifier>{};
+    for (auto i = 0; i < 8; ++i) {
+        ids.push_back(sig.connect([&calls, i](int x) {
+            calls.push_back(i);
+            return x + i;
+        }));
+    }
+    REQUIRE(sig.slot_count() == 8);
+    REQUIRE(!sig.is_empty());
+    REQUIRE(sig(10) == 17);
+    REQUIRE(calls == std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7});
+    for (auto i = std::size_t{1}; i < ids.size(); ++i)
+        REQUIRE(ids[i - 1] < ids[i]);
+
+    REQUIRE(sig.disconnect(ids[7])(0) == 7);
+    calls.clear();
+    sig.disconnect(ids[0]);
+    sig.disconnect(ids[3]);
+    sig.disconnect(ids[4]);
+    REQUIRE_THROWS_AS(sig.disconnect(ids[3]), std::invalid_argument);
+    REQUIRE(sig(10) == 16);
+    REQUIRE(calls == std::vector<int>{1, 2, 5, 6});
+
+    auto const id = sig.connect([](int) { return -1; });
+    REQUIRE(ids[6] < id);
+    REQUIRE(sig(0) == -1);
+    for (auto i : {1, 2, 5, 6})
+        sig.disconnect(ids[i]);
+    sig.disconnect(id);
+    REQUIRE(sig.is_empty());
+    REQUIRE(sig(0) == std::nullopt);
+}
+
+TEMPLATE_TEST_CASE("Storage expired Slots", "[Slot_storage]",
+                   SIGNALS_LIGHT_STORAGE_POLICIES)
+{
+    using Signal_t = sl::Signal<int(), TestType>;
+
+    auto sig   = Signal_t{};
+    auto lives = std::vector<std::unique_ptr<sl::Lifetime>>{};
+    for (auto i = 0; i < 10; ++i) {
+        auto slot = sl::Slot<int()>{[i] { return i; }};
+        if (i % 3 != 1) {
+            lives.push_back(std::make_unique<sl::Lifetime>());
+            slot.track(*lives.back());
+        }
+        sig.connect(std::move(slot));
+    }
+    REQUIRE(sig() == 9);
+    lives.clear();
+    REQUIRE(sig.expired_slot_count() == 7);
+    REQUIRE(sig() == 7);
+    REQUIRE(sig.purge_expired() == 7);
+    REQUIRE(sig.slot_count() == 3);
+    REQUIRE(sig.expired_slot_count() == 0);
+    REQUIRE(sig() == 7);
+    REQUIRE(sig.memory_usage() >= sizeof(sig));
+
+    auto ref = sl::Signal_base{sig};
+    REQUIRE(ref.stats().slots == 3);
+    ref.disconnect_all();
+    REQUIRE(sig.is_empty());
+}
+
+TEMPLATE_TEST_CASE("Storage copy and move", "[Slot_storage]",
+                   SIGNALS_LIGHT_STORAGE_POLICIES)
+{
+    using Signal_t = sl::Signal<int(), TestType>;
+
+    auto sig = Signal_t{};
+    auto ids = std::vector<sl::Identifier>{};
+    for (auto i = 0; i < 5; ++i)
+        ids.push_back(sig.connect([i] { return i; }));
+    sig.disconnect(ids[1]);
+
+    auto copy = sig;
+    REQUIRE(copy.slot_count() == 4);
+    copy.disconnect(ids[4]);
+    REQUIRE(copy() == 3);
+    REQUIRE(sig() == 4);
+
+    auto moved = std::move(sig);
+    REQUIRE(sig.is_empty());
+    REQUIRE(moved() == 4);
+    moved.disconnect(ids[2]);
+
+    sig = moved;
+    REQUIRE(sig.slot_count() == 3);
+    copy = std::move(moved);
+    REQUIRE(moved.is_empty());
+    REQUIRE(copy.slot_count() == 3);
+    REQUIRE_THROWS_AS(copy.disconnect(ids[2]), std::invalid_argument);
+}
+
+TEMPLATE_TEST_CASE("Storage incremental emission", "[Slot_storage]",
+                   SIGNALS_LIGHT_STORAGE_POLICIES)
+{
+    using Signal_t = sl::Signal<void(), TestType>;
+
+    auto sig   = Signal_t{};
+    auto calls = std::vector<int>{};
+    auto ids   = std::vector<sl::Identifier>{};
+    for (auto i = 0; i < 6; ++i)
+        ids.push_back(sig.connect([&calls, i] { calls.push_back(i); }));
+
+    auto cursor = sig.emit_incremental();
+    REQUIRE(!cursor.advance(2));
+    sig.disconnect(ids[1]);
+    sig.disconnect(ids[2]);
+    REQUIRE(!cursor.advance(2));
+    REQUIRE(cursor.advance(5));
+    REQUIRE(calls == std::vector<int>{0, 1, 3, 4, 5});
+}
+
+TEMPLATE_TEST_CASE("Storage random churn matches a model",
+                   "[Slot_storage]",
+                   SIGNALS_LIGHT_STORAGE_POLICIES)
+{
+    using Signal_t = sl::Signal<void(), TestType>;
+
+    auto sig    = Signal_t{};
+    auto model  = std::vector<std::pair<sl::Identifier, int>>{};
+    auto calls  = std::vector<int>{};
+    auto rng    = std::mt19937{7};
+    auto next   = 0;
+    auto agrees = true;
+    for (auto step = 0; step < 3'000; ++step) {
+        auto const op = std::uniform_int_distribution<int>{0, 9}(rng);
+        if (op < 5 && model.size() < 48) {
+            auto const value = next++;
+            auto const id =
+                sig.connect([&calls, value] { calls.push_back(value); });
+            model.emplace_back(id, value);
+        }
+        else if (op < 9 && !model.empty()) {
+            auto const i = std::uniform_int_distribution<std::size_t>{
+                0, model.size() - 1}(rng);
+            sig.disconnect(model[i].first);
+            model.erase(std::begin(model) + static_cast<std::ptrdiff_t>(i));
+        }
+        else {
+            calls.clear();
+            sig();
+            auto expected = std::vector<int>{};
+            for (auto const& entry : model)
+                expected.push_back(entry.second);
+            agrees = agrees && calls == expected &&
+                     sig.slot_count() == model.size();
+        }
+    }
+    REQUIRE(agrees);
+}
+
+TEST_CASE("Small_storage keeps few Slots inline", "[Slot_storage]")
+{
+    auto sig = sl::Signal<void(), sl::Small_storage<2>>{};
+    REQUIRE(sizeof(sig) > 2 * sizeof(sl::Slot<void()>));
+    sig.connect([] {});
+    sig.connect([] {});
+    REQUIRE(sig.memory_usage() == sizeof(sig));
+    sig.connect([] {});
+    REQUIRE(sig.memory_usage() > sizeof(sig));
+}
+
+TEST_CASE("Fixed_storage refuses Slots past its capacity", "[Slot_storage]")
+{
+    auto sig = sl::Signal<int(), sl::Fixed_storage<2>>{};
+    sig.connect([] { return 1; });
+    auto const id = sig.connect([] { return 2; });
+    REQUIRE_THROWS_AS(sig.connect([] { return 3; }), std::length_error);
+    REQUIRE(sig.slot_count() == 2);
+    REQUIRE(sig() == 2);
+    sig.disconnect(id);
+    sig.connect([] { return 3; });
+    REQUIRE(sig() == 3);
+    REQUIRE(sig.memory_usage() == sizeof(sig));
+}
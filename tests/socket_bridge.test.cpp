@@ -0,0 +1,161 @@
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/signal.hpp>
+#include <signals_light/socket_bridge.hpp>
+
+namespace {
+
+/// Encodes an int followed by the bytes of a string.
+struct Int_string_codec {
+    void encode(std::string& out, int i, std::string const& s)
+    {
+        out.append(reinterpret_cast<char const*>(&i), sizeof(i));
+        out.append(s);
+    }
+
+    auto decode(std::string_view frame) -> std::tuple<int, std::string>
+    {
+        auto i = 0;
+        std::memcpy(&i, frame.data(), sizeof(i));
+        return {i, std::string{frame.substr(sizeof(i))}};
+    }
+};
+
+/// Int_string_codec that throws part way through encoding a negative int.
+struct Throwing_codec : Int_string_codec {
+    void encode(std::string& out, int i, std::string const& s)
+    {
+        out.append(reinterpret_cast<char const*>(&i), sizeof(i));
+        if (i < 0)
+            throw std::runtime_error{"Throwing_codec"};
+        out.append(s);
+    }
+};
+
+using Sender =
+    sl::Socket_sender<void(int, std::string const&), Int_string_codec>;
+using Receiver =
+    sl::Socket_receiver<void(int, std::string const&), Int_string_codec>;
+
+struct Socket_pair {
+    int fds[2];
+
+    Socket_pair() { REQUIRE(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0); }
+
+    ~Socket_pair()
+    {
+        ::close(fds[0]);
+        ::close(fds[1]);
+    }
+};
+
+}  // namespace
+
+TEST_CASE("Socket bridge relays emissions in one syscall per batch",
+          "[Socket_bridge]")
+{
+    auto sockets  = Socket_pair{};
+    auto sender   = Sender{sockets.fds[0]};
+    auto receiver = Receiver{sockets.fds[1]};
+    auto received = std::vector<std::pair<int, std::string>>{};
+    receiver.connect([&received](int i, std::string const& s) {
+        received.push_back({i, s});
+    });
+
+    auto sig = sl::Signal<void(int, std::string const&)>{};
+    sig.connect(sender.slot());
+    sig(1, "one");
+    sig(2, "");
+    sig(3, "three");
+    REQUIRE(sender.frame_count() == 3);
+    REQUIRE(sender.syscall_count() == 0);
+    REQUIRE(sender.pending_bytes() > 0);
+
+    REQUIRE(sender.flush());
+    REQUIRE(sender.syscall_count() == 1);
+    REQUIRE(sender.pending_bytes() == 0);
+
+    REQUIRE(receiver.receive() == 3);
+    REQUIRE(received == std::vector<std::pair<int, std::string>>{
+                            {1, "one"}, {2, ""}, {3, "three"}});
+}
+
+TEST_CASE("Socket bridge flushes once the threshold is reached",
+          "[Socket_bridge]")
+{
+    auto sockets  = Socket_pair{};
+    auto sender   = Sender{sockets.fds[0], Int_string_codec{}, 0};
+    auto receiver = Receiver{sockets.fds[1]};
+    auto count    = 0;
+    receiver.connect([&count](int, std::string const&) { ++count; });
+
+    sender(1, "a");
+    sender(2, "b");
+    REQUIRE(sender.syscall_count() == 2);
+    while (count < 2)
+        receiver.receive();
+    REQUIRE(count == 2);
+}
+
+TEST_CASE("Socket_sender drops the partial frame of a throwing Codec",
+          "[Socket_bridge]")
+{
+    using Signature_t = void(int, std::string const&);
+    auto sockets      = Socket_pair{};
+    auto sender =
+        sl::Socket_sender<Signature_t, Throwing_codec>{sockets.fds[0]};
+    auto receiver =
+        sl::Socket_receiver<Signature_t, Throwing_codec>{sockets.fds[1]};
+    auto received = std::vector<std::pair<int, std::string>>{};
+    receiver.connect([&received](int i, std::string const& s) {
+        received.push_back({i, s});
+    });
+
+    sender(1, "before");
+    REQUIRE_THROWS_AS(sender(-1, "lost"), std::runtime_error);
+    REQUIRE(sender.frame_count() == 1);
+    sender(2, "after");
+
+    REQUIRE(sender.flush());
+    REQUIRE(receiver.receive() == 2);
+    REQUIRE(received == std::vector<std::pair<int, std::string>>{
+                            {1, "before"}, {2, "after"}});
+}
+
+TEST_CASE("Socket_receiver reassembles frames split across reads",
+          "[Socket_bridge]")
+{
+    auto sockets  = Socket_pair{};
+    auto receiver = Receiver{sockets.fds[1]};
+    auto received = std::string{};
+    receiver.connect(
+        [&received](int, std::string const& s) { received += s; });
+
+    // Encode one frame by hand, then write it in two pieces.
+    auto frame = std::string{};
+    auto codec = Int_string_codec{};
+    codec.encode(frame, 7, "payload");
+    auto const size = static_cast<sl::Frame_size_t>(frame.size());
+    frame.insert(0, reinterpret_cast<char const*>(&size), sizeof(size));
+
+    REQUIRE(::write(sockets.fds[0], frame.data(), 6) == 6);
+    REQUIRE(receiver.receive() == 0);
+    REQUIRE(::write(sockets.fds[0], frame.data() + 6, frame.size() - 6) ==
+            static_cast<::ssize_t>(frame.size() - 6));
+    REQUIRE(receiver.receive() == 1);
+    REQUIRE(received == "payload");
+
+    ::shutdown(sockets.fds[0], SHUT_WR);
+    REQUIRE(receiver.receive() == 0);
+    REQUIRE(receiver.is_closed());
+}
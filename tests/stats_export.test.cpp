@@ -0,0 +1,104 @@
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include <unistd.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/stats_export.hpp>
+
+namespace {
+
+auto unique_name(char const* tag) -> std::string
+{
+    return "/signals_light_test_" + std::string{tag} + "_" +
+           std::to_string(::getpid());
+}
+
+}  // namespace
+
+TEST_CASE("Exported_signal counters are visible to a Stats_reader",
+          "[Stats_export]")
+{
+    auto exporter = sl::Stats_exporter{unique_name("counts"), 4};
+    REQUIRE(exporter.capacity() == 4);
+    auto clicked = sl::Exported_signal<int(int)>{exporter, "clicked"};
+    auto resized = sl::Exported_signal<void()>{exporter, "resized"};
+    clicked.connect([](int x) { return x; });
+    clicked.connect([](int x) { return x * 2; });
+
+    REQUIRE(*clicked(3) == 6);
+    clicked(4);
+    resized();
+
+    auto const reader  = sl::Stats_reader{exporter.name()};
+    auto const entries = reader.snapshot();
+    REQUIRE(entries.size() == 2);
+    REQUIRE(entries[0].index == 0);
+    REQUIRE(entries[0].name == "clicked");
+    REQUIRE(entries[0].emit_count == 2);
+    REQUIRE(entries[0].slot_count == 2);
+    REQUIRE(entries[0].slot_calls == 4);
+    REQUIRE(entries[0].max_time <= entries[0].total_time);
+    REQUIRE(entries[1].index == 1);
+    REQUIRE(entries[1].name == "resized");
+    REQUIRE(entries[1].emit_count == 1);
+    REQUIRE(entries[1].slot_count == 0);
+
+    clicked(5);
+    REQUIRE(reader.snapshot()[0].emit_count == 3);
+}
+
+TEST_CASE("Exported_signal only counts the Slots it invokes",
+          "[Stats_export]")
+{
+    auto exporter = sl::Stats_exporter{unique_name("expired"), 1};
+    auto sig      = sl::Exported_signal<void()>{exporter, "expired"};
+    auto calls    = 0;
+    sig.connect([&calls] { ++calls; });
+    {
+        auto life = sl::Lifetime{};
+        auto slot = sl::Slot<void()>{[&calls] { ++calls; }};
+        slot.track(life);
+        sig.connect(slot);
+    }
+
+    sig();
+    sig();
+    REQUIRE(calls == 2);
+    auto const entries = sl::Stats_reader{exporter.name()}.snapshot();
+    REQUIRE(entries[0].emit_count == 2);
+    REQUIRE(entries[0].slot_count == 2);
+    REQUIRE(entries[0].slot_calls == 2);
+}
+
+TEST_CASE("Stats_exporter truncates long names and rejects overflow",
+          "[Stats_export]")
+{
+    auto exporter   = sl::Stats_exporter{unique_name("full"), 1};
+    auto const name = std::string(100, 'x');
+    auto sig        = sl::Exported_signal<void()>{exporter, name};
+    REQUIRE_THROWS_AS((sl::Exported_signal<void()>{exporter, "extra"}),
+                      std::length_error);
+
+    auto const entries = sl::Stats_reader{exporter.name()}.snapshot();
+    REQUIRE(entries.size() == 1);
+    REQUIRE(entries[0].name == name.substr(0, entries[0].name.size()));
+    REQUIRE(entries[0].name.size() < name.size());
+}
+
+TEST_CASE("Stats_exporter segments are checked and unlinked",
+          "[Stats_export]")
+{
+    auto const name = unique_name("unlink");
+    REQUIRE_THROWS_AS((sl::Stats_exporter{name, 0}), std::invalid_argument);
+    {
+        auto exporter = sl::Stats_exporter{name, 2};
+        REQUIRE_THROWS_AS((sl::Stats_exporter{name, 2}), std::system_error);
+    }
+    REQUIRE_THROWS_AS(sl::Stats_reader{name}, std::system_error);
+
+    auto shm = sl::Shm_signal<int>{name, 4};
+    REQUIRE_THROWS_AS(sl::Stats_reader{name}, std::invalid_argument);
+}
@@ -0,0 +1,127 @@
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/transaction.hpp>
+
+TEST_CASE("Transactional_signal emits immediately outside a Transaction",
+          "[Transaction]")
+{
+    auto sig    = sl::Transactional_signal<void(int)>{};
+    auto values = std::vector<int>{};
+    sig.connect([&](int x) { values.push_back(x); });
+    REQUIRE(!sl::Transaction::is_active());
+    sig(1);
+    sig(2);
+    REQUIRE(values == std::vector<int>{1, 2});
+}
+
+TEST_CASE("Transaction emits each Signal once, in first emit order",
+          "[Transaction]")
+{
+    auto name   = sl::Transactional_signal<void(std::string const&)>{};
+    auto size   = sl::Transactional_signal<void(int, int)>{};
+    auto events = std::vector<std::string>{};
+    name.connect([&](std::string const& s) { events.push_back("name " + s); });
+    size.connect([&](int w, int h) {
+        events.push_back("size " + std::to_string(w) + "x" +
+                         std::to_string(h));
+    });
+
+    {
+        auto const t = sl::Transaction{};
+        REQUIRE(sl::Transaction::is_active());
+        size(1, 1);
+        name("a");
+        size(2, 3);
+        name("b");
+        REQUIRE(events.empty());
+        REQUIRE(size.is_pending());
+    }
+    REQUIRE(!sl::Transaction::is_active());
+    REQUIRE(!size.is_pending());
+    REQUIRE(events == std::vector<std::string>{"size 2x3", "name b"});
+}
+
+TEST_CASE("Transactional_signal folds deferred emissions", "[Transaction]")
+{
+    auto moved = sl::Transactional_signal<void(int)>{
+        [](std::tuple<int>& total, int delta) { std::get<0>(total) += delta; }};
+    auto totals = std::vector<int>{};
+    moved.connect([&](int x) { totals.push_back(x); });
+    {
+        auto const t = sl::Transaction{};
+        for (auto i = 1; i <= 4; ++i)
+            moved(i);
+    }
+    REQUIRE(totals == std::vector<int>{10});
+}
+
+TEST_CASE("Nested Transactions merge into the outermost", "[Transaction]")
+{
+    auto sig    = sl::Transactional_signal<void(int)>{};
+    auto values = std::vector<int>{};
+    sig.connect([&](int x) { values.push_back(x); });
+    {
+        auto outer = sl::Transaction{};
+        sig(1);
+        {
+            auto inner = sl::Transaction{};
+            sig(2);
+            inner.commit();
+            REQUIRE(values.empty());
+        }
+        REQUIRE(values.empty());
+        sig(3);
+        outer.commit();
+        REQUIRE(values == std::vector<int>{3});
+        sig(4);
+    }
+    REQUIRE(values == std::vector<int>{3, 4});
+}
+
+TEST_CASE("Transaction discards deferred emissions on exception",
+          "[Transaction]")
+{
+    auto sig   = sl::Transactional_signal<void(int)>{};
+    auto count = 0;
+    sig.connect([&](int) { ++count; });
+    try {
+        auto const t = sl::Transaction{};
+        sig(1);
+        throw std::runtime_error{"abort"};
+    }
+    catch (std::runtime_error const&) {
+    }
+    REQUIRE(count == 0);
+    REQUIRE(!sig.is_pending());
+    REQUIRE(!sl::Transaction::is_active());
+}
+
+TEST_CASE("Destroyed Transactional_signals are skipped at commit",
+          "[Transaction]")
+{
+    auto first  = sl::Transactional_signal<void()>{};
+    auto second = std::make_unique<sl::Transactional_signal<void()>>();
+    auto third  = std::make_unique<sl::Transactional_signal<void()>>();
+    auto calls  = std::vector<int>{};
+    first.connect([&] {
+        calls.push_back(1);
+        second.reset();
+    });
+    second->connect([&] { calls.push_back(2); });
+    third->connect([&] { calls.push_back(3); });
+    {
+        auto const t = sl::Transaction{};
+        first();
+        (*second)();
+        (*third)();
+        third.reset();
+    }
+    REQUIRE(calls == std::vector<int>{1});
+}
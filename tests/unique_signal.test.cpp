@@ -0,0 +1,143 @@
+#include <stdexcept>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/unique_signal.hpp>
+
+namespace {
+
+int free_calls = 0;
+
+void free_slot(int x) { free_calls += x; }
+
+void other_free_slot(int) {}
+
+struct Widget {
+    int calls = 0;
+
+    void update(int x) { calls += x; }
+    void redraw(int) {}
+    void fill(int& x) { x = ++calls; }
+};
+
+}  // namespace
+
+TEST_CASE("Slot_key identity", "[Unique_signal]")
+{
+    auto a = Widget{};
+    auto b = Widget{};
+    REQUIRE(sl::Slot_key{&free_slot} == sl::Slot_key{&free_slot});
+    REQUIRE(sl::Slot_key{&free_slot} != sl::Slot_key{&other_free_slot});
+    REQUIRE(sl::Slot_key{&Widget::update, &a} ==
+            sl::Slot_key{&Widget::update, &a});
+    REQUIRE(sl::Slot_key{&Widget::update, &a} !=
+            sl::Slot_key{&Widget::update, &b});
+    REQUIRE(sl::Slot_key{&Widget::update, &a} !=
+            sl::Slot_key{&Widget::redraw, &a});
+    REQUIRE(sl::Slot_key::user(7) == sl::Slot_key::user(7));
+    REQUIRE(sl::Slot_key::user(7) != sl::Slot_key::user(8));
+
+    auto const hash = sl::Slot_key::Hash{};
+    REQUIRE(hash(sl::Slot_key::user(7)) == hash(sl::Slot_key::user(7)));
+}
+
+TEST_CASE("Unique_signal refuses duplicates", "[Unique_signal]")
+{
+    auto sig    = sl::Unique_signal<void(int)>{};
+    auto widget = Widget{};
+    free_calls  = 0;
+
+    auto const [first, inserted] = sig.connect_unique(&Widget::update, widget);
+    REQUIRE(inserted);
+    auto const [again, again_inserted] =
+        sig.connect_unique(&Widget::update, widget);
+    REQUIRE(!again_inserted);
+    REQUIRE(again == first);
+    REQUIRE(sig.connect_unique(&free_slot).second);
+    REQUIRE(!sig.connect_unique(&free_slot).second);
+    REQUIRE(sig.slot_count() == 2);
+
+    sig(3);
+    REQUIRE(widget.calls == 3);
+    REQUIRE(free_calls == 3);
+
+    SECTION("Disconnecting frees the key")
+    {
+        sig.disconnect(first);
+        REQUIRE(!sig.contains(sl::Slot_key{&Widget::update, &widget}));
+        REQUIRE(sig.connect_unique(&Widget::update, widget).second);
+        REQUIRE(sig.slot_count() == 2);
+    }
+
+    SECTION("Plain connect is never a duplicate")
+    {
+        sig.connect(&free_slot);
+        sig(1);
+        REQUIRE(free_calls == 5);
+    }
+}
+
+TEST_CASE("Unique_signal replaces duplicates", "[Unique_signal]")
+{
+    auto sig       = sl::Unique_signal<int()>{};
+    auto const key = sl::Slot_key::user(42);
+
+    auto const old_id = sig.connect_unique(key, [] { return 1; }).first;
+    sig.connect([] { return 2; });
+    auto const [id, inserted] =
+        sig.connect_unique(key, [] { return 3; }, sl::Duplicate::Replace);
+    REQUIRE(inserted);
+    REQUIRE(id != old_id);
+    REQUIRE(sig.slot_count() == 2);
+    REQUIRE(sig() == 3);
+    REQUIRE_THROWS_AS(sig.disconnect(old_id), std::invalid_argument);
+    REQUIRE(sig.contains(key));
+}
+
+TEST_CASE("Unique_signal survives disconnects through the base class",
+          "[Unique_signal]")
+{
+    auto sig   = sl::Unique_signal<void(int)>{};
+    auto other = 0;
+    free_calls = 0;
+
+    auto const f = sig.connect_unique(&free_slot).first;
+    static_cast<sl::Signal<void(int)>&>(sig).disconnect(f);
+    auto const g = sig.connect([&other](int x) { other += x; });
+    REQUIRE(g != f);
+
+    auto const [id, inserted] =
+        sig.connect_unique(&free_slot, sl::Duplicate::Replace);
+    REQUIRE(inserted);
+    REQUIRE(sig.slot_count() == 2);
+    sig(1);
+    REQUIRE(other == 1);
+    REQUIRE(free_calls == 1);
+
+    static_cast<sl::Signal<void(int)>&>(sig).disconnect(id);
+    REQUIRE(sig.connect_unique(&free_slot).second);
+    REQUIRE(sig.slot_count() == 2);
+}
+
+TEST_CASE("Unique_signal methods take non-const reference parameters",
+          "[Unique_signal]")
+{
+    auto sig    = sl::Unique_signal<void(int&)>{};
+    auto widget = Widget{};
+    REQUIRE(sig.connect_unique(&Widget::fill, widget).second);
+    auto x = 0;
+    sig(x);
+    REQUIRE(x == 1);
+}
+
+TEST_CASE("Unique_signal stays fast with many Slots", "[Unique_signal]")
+{
+    auto sig      = sl::Unique_signal<void()>{};
+    auto inserted = 0;
+    for (auto round = 0; round < 2; ++round) {
+        for (auto i = 0u; i < 10'000u; ++i)
+            inserted += sig.connect_unique(sl::Slot_key::user(i), [] {}).second;
+    }
+    REQUIRE(inserted == 10'000);
+    REQUIRE(sig.slot_count() == 10'000);
+}
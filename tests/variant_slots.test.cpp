@@ -0,0 +1,91 @@
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/variant_slots.hpp>
+
+namespace {
+
+struct Doubler {
+    int factor;
+    auto operator()(int x) const -> int { return x * factor; }
+};
+
+auto negate(int x) -> int { return -x; }
+
+using Int_signal = sl::Variant_slots_signal<int(int), Doubler, int (*)(int)>;
+
+}  // namespace
+
+TEST_CASE("Variant_slots_signal with no Slots", "[Variant_slots]")
+{
+    auto sig = Int_signal{};
+    REQUIRE(sig.is_empty());
+    REQUIRE(sig.slot_count() == 0);
+    REQUIRE(sig(3) == std::nullopt);
+}
+
+TEST_CASE("Variant_slots_signal invokes every alternative in order",
+          "[Variant_slots]")
+{
+    auto calls = std::vector<int>{};
+    auto a     = [&calls](int x) { calls.push_back(x); };
+    auto b     = [&calls](int x) { calls.push_back(-x); };
+    auto sig =
+        sl::Variant_slots_signal<void(int), decltype(a), decltype(b)>{};
+    sig.connect(a);
+    sig.connect(b);
+    sig.connect(a);
+    REQUIRE(sig.slot_count() == 3);
+
+    sig(4);
+    REQUIRE(calls == std::vector<int>{4, -4, 4});
+}
+
+TEST_CASE("Variant_slots_signal returns the last Slot result",
+          "[Variant_slots]")
+{
+    auto sig       = Int_signal{};
+    auto const id1 = sig.connect(Doubler{2});
+    auto const id2 = sig.connect(&negate);
+    REQUIRE(id1 != id2);
+    REQUIRE(*sig(5) == -5);
+
+    auto const removed = sig.disconnect(id2);
+    REQUIRE(removed.index() == 1);
+    REQUIRE(*sig(5) == 10);
+    REQUIRE_THROWS_AS(sig.disconnect(id2), std::invalid_argument);
+}
+
+TEST_CASE("Variant_slots_signal never reuses an Identifier", "[Variant_slots]")
+{
+    auto sig          = Int_signal{};
+    auto const old_id = sig.connect(Doubler{2});
+    sig.disconnect(old_id);
+    auto const id = sig.connect(&negate);
+    REQUIRE(id != old_id);
+    REQUIRE_THROWS_AS(sig.disconnect(old_id), std::invalid_argument);
+    REQUIRE(*sig(5) == -5);
+}
+
+TEST_CASE("Variant_slots_signal skips expired Slots", "[Variant_slots]")
+{
+    auto sig = Int_signal{};
+    sig.connect(Doubler{3});
+    {
+        auto life = sl::Lifetime{};
+        sig.connect(&negate, life);
+        REQUIRE(*sig(2) == -2);
+    }
+    REQUIRE(*sig(2) == 6);
+
+    auto owner = std::make_shared<int>(0);
+    sig.connect(Doubler{4}, owner);
+    REQUIRE(*sig(2) == 8);
+    owner.reset();
+    REQUIRE(*sig(2) == 6);
+    REQUIRE(sig.slot_count() == 3);
+}
@@ -0,0 +1,81 @@
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/signal.hpp>
+#include <signals_light/wait.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("wait_next returns nullopt on timeout", "[wait_next]")
+{
+    auto sig    = sl::Signal<void(int)>{};
+    auto waiter = sl::Emission_waiter<void(int)>{sig};
+    REQUIRE(sl::wait_next(waiter, 10ms) == std::nullopt);
+    REQUIRE(waiter.waiter_count() == 0);
+
+    // Emissions with no waiter are not stored for a later wait.
+    sig(5);
+    REQUIRE(sl::wait_next(waiter, 0ms) == std::nullopt);
+}
+
+TEST_CASE("wait_next receives the emitted arguments", "[wait_next]")
+{
+    auto sig    = sl::Signal<void(int, std::string const&)>{};
+    auto waiter = sl::Emission_waiter<void(int, std::string const&)>{sig};
+
+    auto result = std::optional<std::tuple<int, std::string>>{};
+    auto ready  = std::atomic<bool>{false};
+    auto worker = std::thread{[&] {
+        ready  = true;
+        result = sl::wait_next(waiter, 10s);
+    }};
+
+    // Emit until the worker is known to be blocked.
+    while (!ready || waiter.waiter_count() == 0)
+        std::this_thread::yield();
+    sig(7, "seven");
+    worker.join();
+
+    REQUIRE(result.has_value());
+    REQUIRE(std::get<0>(*result) == 7);
+    REQUIRE(std::get<1>(*result) == "seven");
+}
+
+TEST_CASE("wait_next wakes every waiting thread", "[wait_next]")
+{
+    auto sig    = sl::Signal<void(int)>{};
+    auto waiter = sl::Emission_waiter<void(int)>{sig};
+    auto sum    = std::atomic<int>{0};
+
+    auto workers = std::vector<std::thread>{};
+    for (auto i = 0; i < 4; ++i) {
+        workers.emplace_back([&] {
+            auto const r = waiter.wait_next(10s);
+            if (r.has_value())
+                sum += std::get<0>(*r);
+        });
+    }
+    while (waiter.waiter_count() != 4)
+        std::this_thread::yield();
+    sig(3);
+    for (auto& t : workers)
+        t.join();
+    REQUIRE(sum == 12);
+}
+
+TEST_CASE("Emission_waiter Slot expires with the waiter", "[wait_next]")
+{
+    auto sig = sl::Signal<void()>{};
+    {
+        auto waiter = sl::Emission_waiter<void()>{sig};
+        REQUIRE(sig.slot_count() == 1);
+    }
+    REQUIRE_NOTHROW(sig());
+}
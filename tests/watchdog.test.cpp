@@ -0,0 +1,89 @@
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <signals_light/watchdog.hpp>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("Watchdog_signal without a budget emits normally", "[Watchdog]")
+{
+    auto sig = sl::Watchdog_signal<int(int)>{};
+    REQUIRE(!sig.budget().has_value());
+    sig.connect([](int x) { return x + 1; });
+    sig.connect([](int x) { return x * 2; });
+    REQUIRE(*sig(4) == 8);
+}
+
+TEST_CASE("Watchdog_signal reports only slow Slots", "[Watchdog]")
+{
+    auto sig       = sl::Watchdog_signal<int()>{};
+    auto const id1 = sig.connect([] { return 1; });
+    auto const id2 = sig.connect([] {
+        std::this_thread::sleep_for(20ms);
+        return 2;
+    });
+    sig.connect([] { return 3; });
+
+    struct Report {
+        sl::Signal<int()> const* signal;
+        sl::Identifier id;
+        std::chrono::steady_clock::duration elapsed;
+    };
+    auto reports = std::vector<Report>{};
+    sig.set_budget(10ms, [&](auto const& s, sl::Identifier id, auto elapsed) {
+        reports.push_back({&s, id, elapsed});
+    });
+    REQUIRE(sig.budget() == std::chrono::steady_clock::duration{10ms});
+
+    REQUIRE(*sig() == 3);
+    REQUIRE(reports.size() == 1);
+    REQUIRE(reports[0].signal == &sig);
+    REQUIRE(reports[0].id == id2);
+    REQUIRE(reports[0].id != id1);
+    REQUIRE(reports[0].elapsed >= 20ms);
+
+    sig.clear_budget();
+    REQUIRE(!sig.budget().has_value());
+    sig();
+    REQUIRE(reports.size() == 1);
+}
+
+TEST_CASE("Watchdog_signal skips expired Slots", "[Watchdog]")
+{
+    auto sig   = sl::Watchdog_signal<void()>{};
+    auto count = 0;
+    {
+        auto life = sl::Lifetime{};
+        sig.connect(sl::Slot<void()>{[&] { ++count; }}.track(life));
+    }
+    // Sleeping past the zero budget makes every invocation a stall.
+    auto const live = sig.connect([&] {
+        ++count;
+        std::this_thread::sleep_for(1ms);
+    });
+    auto reports = std::vector<sl::Identifier>{};
+    sig.set_budget(0ns, [&](auto const&, sl::Identifier id, auto elapsed) {
+        REQUIRE(elapsed >= 1ms);
+        reports.push_back(id);
+    });
+
+    sig();
+    REQUIRE(count == 1);
+    REQUIRE(reports.size() == 1);
+    REQUIRE(reports[0] == live);
+
+    // One report per stall, the expired Slot is never reported.
+    sig();
+    REQUIRE(count == 2);
+    REQUIRE(reports == std::vector<sl::Identifier>{live, live});
+}
+
+TEST_CASE("Watchdog_signal rejects an empty handler", "[Watchdog]")
+{
+    auto sig = sl::Watchdog_signal<void()>{};
+    REQUIRE_THROWS_AS(sig.set_budget(1ms, nullptr), std::invalid_argument);
+}
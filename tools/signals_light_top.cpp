@@ -0,0 +1,116 @@
+/// Live, top-style view of a Stats_exporter segment.
+/** Shows each Exported_signal's emit rate over the last interval, slot count,
+ *  average time per Slot invocation and worst emission time, busiest first.
+ *
+ *  Usage: signals_light_top <segment name> [interval ms] [--once] */
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <signals_light/stats_export.hpp>
+
+namespace {
+
+struct Row {
+    sl::Stats_reader::Entry entry;
+    double emit_rate;
+    double slot_us;  // Average per Slot invocation over the interval.
+};
+
+auto to_us(std::chrono::nanoseconds d) -> double { return d.count() / 1e3; }
+
+/// Compute rates against \p previous, keyed by Entry::index.
+/** Snapshots skip entries that aren't ready yet, so positions in them can
+ *  shift between samples while segment indices can't. */
+auto make_rows(std::vector<sl::Stats_reader::Entry> const& current,
+               std::map<std::size_t, sl::Stats_reader::Entry> const& previous,
+               double seconds) -> std::vector<Row>
+{
+    auto rows = std::vector<Row>{};
+    for (auto const& now : current) {
+        auto emits = now.emit_count;
+        auto calls = now.slot_calls;
+        auto time  = now.total_time;
+        if (auto const it = previous.find(now.index); it != previous.end()) {
+            emits -= it->second.emit_count;
+            calls -= it->second.slot_calls;
+            time -= it->second.total_time;
+        }
+        auto const rate = seconds > 0. ? emits / seconds : 0.;
+        auto const slot = calls != 0 ? to_us(time) / calls : 0.;
+        rows.push_back({now, rate, slot});
+    }
+    std::sort(rows.begin(), rows.end(), [](auto const& a, auto const& b) {
+        return a.emit_rate > b.emit_rate;
+    });
+    return rows;
+}
+
+void print(std::vector<Row> const& rows, bool clear)
+{
+    if (clear)
+        std::printf("\x1b[H\x1b[2J");
+    std::printf("%-32s %12s %8s %12s %12s %14s\n", "SIGNAL", "EMITS/S",
+                "SLOTS", "SLOT us", "MAX us", "EMITS");
+    for (auto const& r : rows) {
+        std::printf("%-32.32s %12.1f %8llu %12.3f %12.1f %14llu\n",
+                    r.entry.name.c_str(), r.emit_rate,
+                    static_cast<unsigned long long>(r.entry.slot_count),
+                    r.slot_us, to_us(r.entry.max_time),
+                    static_cast<unsigned long long>(r.entry.emit_count));
+    }
+    std::fflush(stdout);
+}
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::fprintf(stderr,
+                     "usage: %s <segment name> [interval ms] [--once]\n",
+                     argv[0]);
+        return 2;
+    }
+    auto interval = std::chrono::milliseconds{1'000};
+    auto once     = false;
+    for (auto i = 2; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--once") == 0)
+            once = true;
+        else
+            interval = std::chrono::milliseconds{std::atol(argv[i])};
+    }
+
+    try {
+        auto const reader = sl::Stats_reader{argv[1]};
+        auto previous     = std::map<std::size_t, sl::Stats_reader::Entry>{};
+        auto last         = std::chrono::steady_clock::now();
+        while (true) {
+            auto const current = reader.snapshot();
+            auto const now     = std::chrono::steady_clock::now();
+            auto const seconds =
+                std::chrono::duration<double>(now - last).count();
+            print(make_rows(current, previous, previous.empty() ? 0. : seconds),
+                  !once);
+            if (once)
+                return 0;
+            previous.clear();
+            for (auto const& entry : current)
+                previous.emplace(entry.index, entry);
+            last = now;
+            std::this_thread::sleep_for(interval);
+        }
+    }
+    catch (std::exception const& e) {
+        std::fprintf(stderr, "%s: %s\n", argv[0], e.what());
+        return 1;
+    }
+}